@@ -9,8 +9,12 @@
 
 #include <stdint.h>
 
+/* Row-major, MSB-first scanlines (ssd1306_buffer_draw_bitmap) */
 extern const uint8_t hots_logo_64x64[];
 
+/* Page-major GRAM layout (ssd1306_buffer_draw_bitmap_pages) */
+extern const uint8_t hots_logo_64x64_pages[];
+
 #define IMG_LOGO_WIDTH  64
 #define IMG_LOGO_HEIGHT 64
 
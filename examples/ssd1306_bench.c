@@ -0,0 +1,523 @@
+/**
+ * SSD1306 benchmarks: framebuffer rendering cost of the drawing primitives.
+ *
+ * Each case runs for a fixed time window and counts iterations, so the
+ * results are comparable between builds and between targets. Drawing cases
+ * touch only the framebuffer (no flush), which isolates CPU cost from bus
+ * time. Flush cases redraw a region of a given size and flush it, so they
+ * show how flush cost scales with the dirty area.
+ *
+ * Assumptions:
+ *  - ssd1306_init() is called before running the benchmarks (e.g. in main)
+ *  - ssd1306_time_ticks_ms() is backed by a running millisecond clock
+ *    (DWT / SysTick on target, any monotonic clock on a host build)
+ *  - define SSD1306_BENCH_STDOUT to also print results with printf()
+ *  - with SSD1306_STATS, bus transactions and bytes per flush are shown
+ *    for the flush cases after the timing results
+ *  - the longest single ssd1306_flush_step() call while refreshing full
+ *    frames is shown last (worst case per call for a given byte budget)
+ *  - flush results depend on the transport: build once with I2C and once
+ *    with SSD1306_USE_SPI to compare them ("Fl full" is frames per second);
+ *    the transport is named on the last screen
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ssd1306_conf.h"
+#include "ssd1306_priv.h"
+#include "ssd1306_utils.h"
+#include "ssd1306.h"
+#include "ssd1306_images.h"
+
+/* Measurement window per case, in milliseconds */
+#ifndef SSD1306_BENCH_WINDOW_MS
+#define SSD1306_BENCH_WINDOW_MS 1000U
+#endif
+
+/* Transport the flush results were measured on */
+#ifdef SSD1306_USE_SPI
+#define BENCH_BUS_NAME "SPI"
+#else
+#define BENCH_BUS_NAME "I2C"
+#endif
+
+/* Byte budget per ssd1306_flush_step() call in the step benchmark */
+#ifndef SSD1306_BENCH_STEP_BYTES
+#define SSD1306_BENCH_STEP_BYTES 128U
+#endif
+
+/* Full frames refreshed step by step in the step benchmark */
+#ifndef SSD1306_BENCH_STEP_FRAMES
+#define SSD1306_BENCH_STEP_FRAMES 8U
+#endif
+
+typedef void (*bench_fn_t)(uint32_t iter);
+
+/* ======================================================================
+ * Helpers
+ * ====================================================================== */
+
+/* Run 'fn' repeatedly for SSD1306_BENCH_WINDOW_MS, return calls per second */
+static float bench_run(bench_fn_t fn) {
+	uint32_t start;
+	uint32_t end;
+	uint32_t iter;
+
+	start = ssd1306_time_ticks_ms();
+	end   = start;
+	iter  = 0U;
+
+	do {
+		fn(iter);
+		iter++;
+		if ((iter & 0x3FU) == 0U) {
+			end = ssd1306_time_ticks_ms();
+			SSD1306_FEED_WATCHDOG();
+		}
+	} while ((end - start) < SSD1306_BENCH_WINDOW_MS);
+
+	return (float)iter * 1000.0f / (float)(end - start);
+}
+
+/* Report one result line: on screen, and optionally on stdout */
+static void bench_report(uint8_t line, const char *name, float value) {
+	char buff[32];
+
+	(void)snprintf(buff, sizeof(buff), "%s %.0f/s", name, value);
+	ssd1306_buffer_draw_string_font(buff, 0,
+	                                (uint8_t)(line * (SSD1306_FONT_DEFAULT->height + 1U)),
+	                                SSD1306_FONT_DEFAULT, White);
+#ifdef SSD1306_BENCH_STDOUT
+	(void)printf("%s\n", buff);
+#endif
+}
+
+/* ======================================================================
+ * Filled rectangles
+ * ====================================================================== */
+
+/* Reference: the former per-pixel implementation of fill_rect_xy */
+static void bench_fill_rect_per_pixel(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                                      SSD1306_COLOR_t color) {
+	int16_t x, y;
+
+	for (y = y0; y <= y1; y++) {
+		if (y < 0 || y >= (int16_t)SSD1306_HEIGHT) {
+			continue;
+		}
+		for (x = x0; x <= x1; x++) {
+			if (x < 0 || x >= (int16_t)SSD1306_WIDTH) {
+				continue;
+			}
+			ssd1306_buffer_draw_pixel((uint8_t)x, (uint8_t)y, color);
+		}
+	}
+}
+
+static void bench_fill_screen_pixel(uint32_t iter) {
+	bench_fill_rect_per_pixel(0, 0, SSD1306_WIDTH - 1, SSD1306_HEIGHT - 1,
+	                          (iter % 2U) ? White : Black);
+}
+
+static void bench_fill_screen_span(uint32_t iter) {
+	ssd1306_buffer_fill_rect_xy(0, 0, SSD1306_WIDTH - 1, SSD1306_HEIGHT - 1,
+	                            (iter % 2U) ? White : Black);
+}
+
+/* Menu-row sized rectangle at an unaligned y (partial top/bottom pages) */
+static void bench_fill_row_pixel(uint32_t iter) {
+	bench_fill_rect_per_pixel(4, 19, SSD1306_WIDTH - 12, 33, (iter % 2U) ? White : Black);
+}
+
+static void bench_fill_row_span(uint32_t iter) {
+	ssd1306_buffer_fill_rect_xy(4, 19, SSD1306_WIDTH - 12, 33, (iter % 2U) ? White : Black);
+}
+
+/* ======================================================================
+ * Filled circles
+ * ====================================================================== */
+
+/* Reference: the former midpoint fill, four per-pixel spans per step */
+static void bench_fill_circle_per_pixel(int16_t xc, int16_t yc, int16_t r, SSD1306_COLOR_t color) {
+	int16_t x = 0;
+	int16_t y = r;
+	int16_t d = (int16_t)(3 - 2 * r);
+	int16_t i;
+
+	while (y >= x) {
+		for (i = (int16_t)(xc - x); i <= (int16_t)(xc + x); i++) {
+			ssd1306_buffer_draw_pixel((uint8_t)i, (uint8_t)(yc + y), color);
+			ssd1306_buffer_draw_pixel((uint8_t)i, (uint8_t)(yc - y), color);
+		}
+		for (i = (int16_t)(xc - y); i <= (int16_t)(xc + y); i++) {
+			ssd1306_buffer_draw_pixel((uint8_t)i, (uint8_t)(yc + x), color);
+			ssd1306_buffer_draw_pixel((uint8_t)i, (uint8_t)(yc - x), color);
+		}
+
+		x++;
+		if (d > 0) {
+			y--;
+			d = (int16_t)(d + 4 * (x - y) + 10);
+		} else {
+			d = (int16_t)(d + 4 * x + 6);
+		}
+	}
+}
+
+/* Gauge hub sized circle */
+static void bench_circle_pixel(uint32_t iter) {
+	bench_fill_circle_per_pixel(64, 32, 20, (iter % 2U) ? White : Black);
+}
+
+static void bench_circle_span(uint32_t iter) {
+	ssd1306_buffer_fill_circle(64, 32, 20, (iter % 2U) ? White : Black);
+}
+
+/* ======================================================================
+ * Filled triangles
+ * ====================================================================== */
+
+/* Reference: the former float interpolation, one clipped line per scanline */
+static void bench_fill_triangle_float(int x0, int y0, int x1, int y1, int x2, int y2,
+                                      SSD1306_COLOR_t color) {
+	int total_height;
+	int i;
+	int segment_height;
+	int ax, bx;
+	int second_half;
+	float alpha, beta;
+
+	if (y0 > y1) { ssd1306_util_swap_int(&y0, &y1); ssd1306_util_swap_int(&x0, &x1); }
+	if (y1 > y2) { ssd1306_util_swap_int(&y1, &y2); ssd1306_util_swap_int(&x1, &x2); }
+	if (y0 > y1) { ssd1306_util_swap_int(&y0, &y1); ssd1306_util_swap_int(&x0, &x1); }
+
+	total_height = y2 - y0;
+
+	for (i = 0; i < total_height; i++) {
+		second_half = (i > y1 - y0 || y1 == y0);
+		segment_height = second_half ? (y2 - y1) : (y1 - y0);
+		if (segment_height == 0) {
+			continue;
+		}
+
+		alpha = (float)i / (float)total_height;
+		beta = (float)(i - (second_half ? (y1 - y0) : 0)) / (float)segment_height;
+
+		ax = x0 + (int)((x2 - x0) * alpha);
+		bx = second_half ?
+			(x1 + (int)((x2 - x1) * beta)) :
+			(x0 + (int)((x1 - x0) * beta));
+
+		if (ax > bx) {
+			ssd1306_util_swap_int(&ax, &bx);
+		}
+		ssd1306_buffer_draw_line((int16_t)ax, (int16_t)(y0 + i),
+		                         (int16_t)bx, (int16_t)(y0 + i), color);
+	}
+}
+
+static void bench_triangle_float(uint32_t iter) {
+	bench_fill_triangle_float(10, 5, 120, 30, 40, 60, (iter % 2U) ? White : Black);
+}
+
+static void bench_triangle_int(uint32_t iter) {
+	ssd1306_buffer_fill_triangle(10, 5, 120, 30, 40, 60, (iter % 2U) ? White : Black);
+}
+
+/* ======================================================================
+ * Text
+ * ====================================================================== */
+
+/* Reference: the former per-pixel glyph renderer (row-major font walk) */
+static void bench_char_per_pixel(char ch, uint8_t x, uint8_t y,
+                                 const SSD1306_Font_t *font, SSD1306_COLOR_t color) {
+	uint8_t row, col_byte, byte, bit, pixel_on;
+	uint8_t bytes_per_row;
+	uint32_t char_offset;
+
+	bytes_per_row = (uint8_t)((font->width + 7u) / 8u);
+	char_offset = (uint32_t)(ch - 32) * font->height * bytes_per_row;
+
+	for (row = 0; row < font->height; row++) {
+		for (col_byte = 0; col_byte < bytes_per_row; col_byte++) {
+			byte = font->data[char_offset + (uint32_t)row * bytes_per_row + col_byte];
+			for (bit = 0; bit < 8u; bit++) {
+				pixel_on = (uint8_t)((byte >> (7u - bit)) & 0x01u);
+				ssd1306_buffer_draw_pixel((uint8_t)(x + (uint8_t)(col_byte * 8u) + bit),
+				                          (uint8_t)(y + row),
+				                          pixel_on ? color : (SSD1306_COLOR_t)!color);
+			}
+		}
+	}
+}
+
+/* Cycle through printable ASCII at an unaligned y (two-page merge) */
+static void bench_char_pixel(uint32_t iter) {
+	bench_char_per_pixel((char)(0x21U + iter % 0x5EU), 40, 19, SSD1306_FONT_DEFAULT, White);
+}
+
+static void bench_char_blit(uint32_t iter) {
+	ssd1306_buffer_draw_char_font((char)(0x21U + iter % 0x5EU), 40, 19, SSD1306_FONT_DEFAULT, White);
+}
+
+/* ======================================================================
+ * Bitmaps
+ * ====================================================================== */
+
+/* Reference: the former per-pixel scanline bitmap decoder */
+static void bench_bitmap_per_pixel(int16_t x, int16_t y, const uint8_t *image,
+                                   int16_t width, int16_t height, SSD1306_COLOR_t color) {
+	int16_t i, j;
+	uint8_t byte;
+	int bytes_per_row;
+
+	bytes_per_row = (int)((width + 7) / 8);
+
+	for (j = 0; j < height; j++) {
+		if (y + j < 0 || y + j >= (int16_t)SSD1306_HEIGHT) {
+			continue;
+		}
+		for (i = 0; i < width; i++) {
+			if (x + i < 0 || x + i >= (int16_t)SSD1306_WIDTH) {
+				continue;
+			}
+			byte = image[j * bytes_per_row + (i / 8)];
+			ssd1306_buffer_draw_pixel((uint8_t)(x + i), (uint8_t)(y + j),
+			                          (byte & (uint8_t)(0x80u >> (i % 8))) ? color : (SSD1306_COLOR_t)!color);
+		}
+	}
+}
+
+static void bench_bitmap_pixel(uint32_t iter) {
+	bench_bitmap_per_pixel(32, 0, hots_logo_64x64, IMG_LOGO_WIDTH, IMG_LOGO_HEIGHT,
+	                       (iter % 2U) ? White : Black);
+}
+
+static void bench_bitmap_rows(uint32_t iter) {
+	ssd1306_buffer_draw_bitmap(32, 0, hots_logo_64x64, IMG_LOGO_WIDTH, IMG_LOGO_HEIGHT,
+	                           (iter % 2U) ? White : Black);
+}
+
+static void bench_bitmap_pages(uint32_t iter) {
+	ssd1306_buffer_draw_bitmap_pages(32, 0, hots_logo_64x64_pages, IMG_LOGO_WIDTH, IMG_LOGO_HEIGHT,
+	                                 (iter % 2U) ? White : Black);
+}
+
+/* Same image at an unaligned y: two-page shift-merge per destination byte */
+static void bench_bitmap_pages_unaligned(uint32_t iter) {
+	ssd1306_buffer_draw_bitmap_pages(32, -3, hots_logo_64x64_pages, IMG_LOGO_WIDTH, IMG_LOGO_HEIGHT,
+	                                 (iter % 2U) ? White : Black);
+}
+
+/* ======================================================================
+ * Flush cost vs dirty region size
+ * ====================================================================== */
+
+/* Nothing dirty: pure bookkeeping cost of a flush */
+static void bench_flush_clean(uint32_t iter) {
+	(void)iter;
+	ssd1306_flush_dirty();
+}
+
+static void bench_flush_pixel(uint32_t iter) {
+	ssd1306_buffer_draw_pixel(70, 30, (iter % 2U) ? White : Black);
+	ssd1306_flush_dirty();
+}
+
+static void bench_flush_glyph(uint32_t iter) {
+	ssd1306_buffer_draw_char_font((char)(0x21U + iter % 0x5EU), 40, 19, SSD1306_FONT_DEFAULT, White);
+	ssd1306_flush_dirty();
+}
+
+static void bench_flush_row(uint32_t iter) {
+	ssd1306_buffer_fill_rect_xy(0, 16, SSD1306_WIDTH - 1, 31, (iter % 2U) ? White : Black);
+	ssd1306_flush_dirty();
+}
+
+/* Narrow box over three pages: one windowed stream */
+static void bench_flush_box(uint32_t iter) {
+	ssd1306_buffer_fill_rect_xy(20, 8, 59, 31, (iter % 2U) ? White : Black);
+	ssd1306_flush_dirty();
+}
+
+/* Widget clear-then-redraw with unchanged content: the final bytes equal
+ * what the panel shows (sent only without SSD1306_SHADOW_GRAM/_HASH)
+ */
+static void bench_flush_redraw(uint32_t iter) {
+	(void)iter;
+	ssd1306_buffer_fill_rect_xy(0, 16, SSD1306_WIDTH - 1, 31, Black);
+	ssd1306_buffer_draw_string_font("Redraw", 8, 17, SSD1306_FONT_DEFAULT, White);
+	ssd1306_flush_dirty();
+}
+
+/* Every other column of one page: worst case for per-run addressing */
+static void bench_flush_comb(uint32_t iter) {
+	int16_t x;
+
+	for (x = 0; x < SSD1306_WIDTH; x += 2) {
+		ssd1306_buffer_draw_line(x, 16, x, 23, (iter % 2U) ? White : Black);
+	}
+	ssd1306_flush_dirty();
+}
+
+static void bench_flush_full(uint32_t iter) {
+	ssd1306_buffer_fill_rect_xy(0, 0, SSD1306_WIDTH - 1, SSD1306_HEIGHT - 1, (iter % 2U) ? White : Black);
+	ssd1306_flush_dirty();
+}
+
+/* ======================================================================
+ * Incremental flush: worst case per step
+ * ====================================================================== */
+
+/* Refresh full frames in SSD1306_BENCH_STEP_BYTES steps, drawing between
+ * steps the way a control loop would, and show the longest call
+ */
+static void bench_flush_step(void) {
+	char buff[32];
+	uint32_t worst = 0U;
+	uint32_t calls = 0U;
+	uint32_t start;
+	uint32_t elapsed;
+	uint32_t frame;
+	uint8_t more;
+
+	for (frame = 0U; frame < SSD1306_BENCH_STEP_FRAMES; frame++) {
+		ssd1306_buffer_fill((frame % 2U) ? White : Black);
+		do {
+			ssd1306_buffer_draw_pixel((uint8_t)(calls % SSD1306_WIDTH), (uint8_t)(SSD1306_HEIGHT / 2U),
+			                          (calls % 2U) ? White : Black);
+
+			start = ssd1306_time_ticks_ms();
+			more = ssd1306_flush_step(SSD1306_BENCH_STEP_BYTES);
+			elapsed = ssd1306_time_ticks_ms() - start;
+
+			worst = (elapsed > worst) ? elapsed : worst;
+			calls++;
+			SSD1306_FEED_WATCHDOG();
+		} while (more);
+	}
+
+	(void)snprintf(buff, sizeof(buff), "%s step %uB: %lums", BENCH_BUS_NAME,
+	               (unsigned)SSD1306_BENCH_STEP_BYTES, (unsigned long)worst);
+	ssd1306_buffer_fill(Black);
+	ssd1306_buffer_draw_string_font(buff, 0, 0, SSD1306_FONT_DEFAULT, White);
+	(void)snprintf(buff, sizeof(buff), "%lu calls/frame", (unsigned long)(calls / SSD1306_BENCH_STEP_FRAMES));
+	ssd1306_buffer_draw_string_font(buff, 0, (uint8_t)(SSD1306_FONT_DEFAULT->height + 1U),
+	                                SSD1306_FONT_DEFAULT, White);
+	ssd1306_flush_dirty();
+#ifdef SSD1306_BENCH_STDOUT
+	(void)printf("%s step %uB: %lums max, %lu calls/frame\n", BENCH_BUS_NAME,
+	             (unsigned)SSD1306_BENCH_STEP_BYTES, (unsigned long)worst,
+	             (unsigned long)(calls / SSD1306_BENCH_STEP_FRAMES));
+#endif
+}
+
+/* ======================================================================
+ * Entry point
+ * ====================================================================== */
+
+typedef struct {
+	const char	*name;
+	bench_fn_t	fn;
+} bench_case_t;
+
+static const bench_case_t bench_cases[] = {
+	{ "Fill px:",  bench_fill_screen_pixel },
+	{ "Fill span:", bench_fill_screen_span },
+	{ "Row px:",   bench_fill_row_pixel },
+	{ "Row span:", bench_fill_row_span },
+	{ "Circ px:",  bench_circle_pixel },
+	{ "Circ span:", bench_circle_span },
+	{ "Tri flt:",  bench_triangle_float },
+	{ "Tri int:",  bench_triangle_int },
+	{ "Chr px:",   bench_char_pixel },
+	{ "Chr blit:", bench_char_blit },
+	{ "Bmp px:",   bench_bitmap_pixel },
+	{ "Bmp rows:", bench_bitmap_rows },
+	{ "Bmp pg:",   bench_bitmap_pages },
+	{ "Bmp pg-3:", bench_bitmap_pages_unaligned },
+	{ "Fl clean:", bench_flush_clean },
+	{ "Fl pixel:", bench_flush_pixel },
+	{ "Fl glyph:", bench_flush_glyph },
+	{ "Fl row:",   bench_flush_row },
+	{ "Fl box:",   bench_flush_box },
+	{ "Fl redraw:", bench_flush_redraw },
+	{ "Fl comb:",  bench_flush_comb },
+	{ "Fl full:",  bench_flush_full },
+};
+
+#define BENCH_CASES_COUNT (sizeof(bench_cases) / sizeof(bench_cases[0]))
+
+#ifdef SSD1306_STATS
+static const bench_case_t bench_flush_cases[] = {
+	{ "Pixel",  bench_flush_pixel },
+	{ "Glyph",  bench_flush_glyph },
+	{ "Row",    bench_flush_row },
+	{ "Box",    bench_flush_box },
+	{ "Redraw", bench_flush_redraw },
+	{ "Comb",   bench_flush_comb },
+	{ "Full",   bench_flush_full },
+};
+
+#define BENCH_FLUSH_CASES_COUNT (sizeof(bench_flush_cases) / sizeof(bench_flush_cases[0]))
+
+/* One flush per case: bus transactions and bytes it took */
+static void bench_flush_stats(void) {
+	char buff[32];
+	uint8_t i;
+
+	for (i = 0; i < BENCH_FLUSH_CASES_COUNT; i++) {
+		/* Start every case from a clean, black screen */
+		ssd1306_buffer_fill(Black);
+		ssd1306_flush_dirty();
+
+		bench_flush_cases[i].fn(1U);
+		(void)snprintf(buff, sizeof(buff), "%s %lutx %luB", bench_flush_cases[i].name,
+		               (unsigned long)ssd1306_stats.last_flush_transactions,
+		               (unsigned long)ssd1306_stats.last_flush_bytes);
+
+		ssd1306_buffer_fill(Black);
+		ssd1306_buffer_draw_string_font(buff, 0, 0, SSD1306_FONT_DEFAULT, White);
+		ssd1306_flush_dirty();
+#ifdef SSD1306_BENCH_STDOUT
+		(void)printf("%s\n", buff);
+#endif
+		SSD1306_DELAY_MS(1000);
+	}
+}
+#endif
+
+void ssd1306_example_bench(void) {
+	float results[BENCH_CASES_COUNT];
+	uint8_t lines_per_screen;
+	uint8_t i;
+
+	for (i = 0; i < BENCH_CASES_COUNT; i++) {
+		results[i] = bench_run(bench_cases[i].fn);
+	}
+
+	/* Show results screen by screen */
+	lines_per_screen = (uint8_t)(SSD1306_HEIGHT / (SSD1306_FONT_DEFAULT->height + 1U));
+
+	for (i = 0; i < BENCH_CASES_COUNT; i++) {
+		if ((i % lines_per_screen) == 0U) {
+			if (i != 0U) {
+				ssd1306_flush_dirty();
+				SSD1306_DELAY_MS(2000);
+			}
+			ssd1306_buffer_fill(Black);
+		}
+		bench_report((uint8_t)(i % lines_per_screen), bench_cases[i].name, results[i]);
+	}
+
+	ssd1306_flush_dirty();
+
+#ifdef SSD1306_STATS
+	SSD1306_DELAY_MS(2000);
+	bench_flush_stats();
+#endif
+
+	SSD1306_DELAY_MS(2000);
+	bench_flush_step();
+}
@@ -240,6 +240,7 @@ static float test_fps_torn_drawing(void) {
     do {
         memset(ssd1306_buffer, (iter % 2U) ? White : Black, sizeof(ssd1306_buffer));
         memset(ssd1306_dirty_flags, 0xAA, sizeof(ssd1306_dirty_flags));
+        ssd1306_dirty_sync_extents();
         ssd1306_flush_dirty();
 
         fps  += 1.0f;
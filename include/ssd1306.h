@@ -27,6 +27,7 @@
 #include <stdint.h>
 #include "ssd1306_conf.h"
 #include "ssd1306_fonts.h"
+#include "ssd1306_transport.h"
 
 /* =======================================================================
  * Version
@@ -49,6 +50,29 @@ typedef enum {
 	White = 0x01   /* pixel on   */
 } SSD1306_COLOR_t;
 
+/*
+ * Raster operation used when text and bitmaps are combined with the
+ * framebuffer. 'src' is the image bit (1 = set), 'dst' the framebuffer bit.
+ *
+ *  COPY         opaque: set bits in 'color', clear bits in the opposite color
+ *  TRANSPARENT  set bits in 'color', clear bits leave the background as is
+ *  OR           dst |= src
+ *  AND          dst &= src
+ *  XOR          dst ^= src (set bits invert the background)
+ *  AND_NOT      dst &= ~src (set bits punch holes into the background)
+ *
+ * For OR, AND, XOR and AND_NOT 'color' selects the source polarity:
+ * White uses the image as stored, Black uses the inverted image.
+ */
+typedef enum {
+	SSD1306_ROP_COPY        = 0x00,
+	SSD1306_ROP_TRANSPARENT = 0x01,
+	SSD1306_ROP_OR          = 0x02,
+	SSD1306_ROP_AND         = 0x03,
+	SSD1306_ROP_XOR         = 0x04,
+	SSD1306_ROP_AND_NOT     = 0x05
+} SSD1306_ROP_t;
+
 /* Display dimensions in bytes */
 #define SSD1306_HEIGHT_BYTES (SSD1306_HEIGHT / 8)
 #define SSD1306_WIDTH_BYTES  (SSD1306_WIDTH  / 8)
@@ -61,6 +85,21 @@ typedef enum {
 #define SSD1306_INVERT_ON    1
 #define SSD1306_INVERT_OFF   0
 
+/* Hardware scroll directions */
+#define SSD1306_SCROLL_RIGHT 0
+#define SSD1306_SCROLL_LEFT  1
+
+/* Hardware scroll step interval, in frames (about 100 frames per second
+ * with the default clock setup) */
+#define SSD1306_SCROLL_FRAMES_2    0x07
+#define SSD1306_SCROLL_FRAMES_3    0x04
+#define SSD1306_SCROLL_FRAMES_4    0x05
+#define SSD1306_SCROLL_FRAMES_5    0x00
+#define SSD1306_SCROLL_FRAMES_25   0x06
+#define SSD1306_SCROLL_FRAMES_64   0x01
+#define SSD1306_SCROLL_FRAMES_128  0x02
+#define SSD1306_SCROLL_FRAMES_256  0x03
+
 /* Built-in fonts (enabled via SSD1306_INCLUDE_FONT_xx in ssd1306_conf.h) */
 #ifdef SSD1306_INCLUDE_FONT_16x30
 extern const SSD1306_Font_t font_16x30;
@@ -78,8 +117,20 @@ extern const SSD1306_Font_t font_8x8;
  * Core control functions
  * -------------------------------------------------------------------------- */
 
-/* Initialize the display and internal framebuffer */
-void ssd1306_init(void);
+/*
+ * Initialize the display and internal framebuffer. Returns the first
+ * error of the bus setup, the controller setup or the first flush. The
+ * driver is usable either way: a display that does not answer yet is
+ * handled as after failed flushes (see ssd1306_flush_dirty()).
+ */
+ssd1306_status_t ssd1306_init(void);
+
+/*
+ * Same as ssd1306_init(), talking to the controller through 'transport'
+ * instead of the platform default (SSD1306_TRANSPORT_DEFAULT). The
+ * transport must stay valid while the driver is in use.
+ */
+ssd1306_status_t ssd1306_init_ex(const ssd1306_transport_t *transport);
 
 /* Turn display on or off (SSD1306_DISPLAY_ON / SSD1306_DISPLAY_OFF) */
 void ssd1306_set_display_on(uint8_t on);
@@ -93,6 +144,24 @@ void ssd1306_set_invert(uint8_t invert);
 /* Send command + single parameter to the controller */
 void ssd1306_write_command_ex(uint8_t cmd, uint8_t param);
 
+/* --------------------------------------------------------------------------
+ * Clipping
+ * --------------------------------------------------------------------------
+ * All framebuffer drawing functions draw only inside the current clip
+ * rectangle (initially the whole screen). A pushed rectangle is intersected
+ * with the current one, so nested widgets can never draw outside their
+ * parent. ssd1306_buffer_fill() ignores the clip rectangle.
+ */
+
+/* Push clip rectangle (x, y, w, h). Returns 0 if the stack is full. */
+uint8_t ssd1306_clip_push(int16_t x, int16_t y, int16_t w, int16_t h);
+
+/* Restore the clip rectangle active before the last push */
+void ssd1306_clip_pop(void);
+
+/* Drop all pushed rectangles, clip to the whole screen */
+void ssd1306_clip_reset(void);
+
 /* --------------------------------------------------------------------------
  * Framebuffer drawing API
  * -------------------------------------------------------------------------- */
@@ -105,6 +174,14 @@ char ssd1306_buffer_draw_char_font(char ch,
                                    const SSD1306_Font_t *font,
                                    SSD1306_COLOR_t color);
 
+/* Same as ssd1306_buffer_draw_char_font(), combined with raster op 'rop' */
+char ssd1306_buffer_draw_char_font_ex(char ch,
+                                      uint8_t x,
+                                      uint8_t y,
+                                      const SSD1306_Font_t *font,
+                                      SSD1306_COLOR_t color,
+                                      SSD1306_ROP_t rop);
+
 char ssd1306_buffer_draw_char(char ch,
                               uint8_t x,
                               uint8_t y,
@@ -116,14 +193,34 @@ void ssd1306_buffer_draw_string_font(const char *str,
                                      const SSD1306_Font_t *font,
                                      SSD1306_COLOR_t color);
 
+/* Same as ssd1306_buffer_draw_string_font(), combined with raster op 'rop' */
+void ssd1306_buffer_draw_string_font_ex(const char *str,
+                                        uint8_t x,
+                                        uint8_t y,
+                                        const SSD1306_Font_t *font,
+                                        SSD1306_COLOR_t color,
+                                        SSD1306_ROP_t rop);
+
 void ssd1306_buffer_draw_string(const char *str,
                                 uint8_t x,
                                 uint8_t y,
                                 SSD1306_COLOR_t color);
 
-/* Fill entire framebuffer with given color */
+/* Fill entire framebuffer with given color (ignores the clip rectangle) */
 void ssd1306_buffer_fill(SSD1306_COLOR_t color);
 
+/*
+ * Move the whole picture up by 'rows' (down when negative), circularly:
+ * rows leaving the top come back in at the bottom. Nothing is copied or
+ * marked dirty; the framebuffer is addressed through the display start
+ * line, which the next flush programs, so afterwards only what is drawn
+ * anew goes on the bus. Drawing coordinates keep referring to the
+ * display. One row per frame gives smooth pixel-by-pixel scrolling.
+ * Needs a 64-row panel (the start line wraps at the multiplex ratio);
+ * returns SSD1306_ERR on others.
+ */
+ssd1306_status_t ssd1306_buffer_scroll_rows(int8_t rows);
+
 /* Fill framebuffer with black and flush to display */
 void ssd1306_display_clear(void);
 
@@ -181,6 +278,39 @@ void ssd1306_buffer_draw_bitmap(int16_t x,
                                 int16_t height,
                                 SSD1306_COLOR_t color);
 
+/* Same as ssd1306_buffer_draw_bitmap(), combined with raster op 'rop' */
+void ssd1306_buffer_draw_bitmap_ex(int16_t x,
+                                   int16_t y,
+                                   const uint8_t *image,
+                                   int16_t width,
+                                   int16_t height,
+                                   SSD1306_COLOR_t color,
+                                   SSD1306_ROP_t rop);
+
+/*
+ * Draw 1bpp bitmap stored in SSD1306 page-major (GRAM) order:
+ * image[page * width + column], bit 0 = top row of the page,
+ * width * ((height + 7) / 8) bytes in total.
+ * Whole bytes are copied when y is a multiple of 8; the image is clipped
+ * to the clip rectangle. Width and height are limited to the panel size.
+ * 'color' is used for bit=1, the opposite color is used for bit=0.
+ */
+void ssd1306_buffer_draw_bitmap_pages(int16_t x,
+                                      int16_t y,
+                                      const uint8_t *image,
+                                      int16_t width,
+                                      int16_t height,
+                                      SSD1306_COLOR_t color);
+
+/* Same as ssd1306_buffer_draw_bitmap_pages(), combined with raster op 'rop' */
+void ssd1306_buffer_draw_bitmap_pages_ex(int16_t x,
+                                         int16_t y,
+                                         const uint8_t *image,
+                                         int16_t width,
+                                         int16_t height,
+                                         SSD1306_COLOR_t color,
+                                         SSD1306_ROP_t rop);
+
 void ssd1306_buffer_draw_triangle(int x0,
                                   int y0,
                                   int x1,
@@ -197,7 +327,98 @@ void ssd1306_buffer_fill_triangle(int x0,
                                   int y2,
                                   SSD1306_COLOR_t color);
 
-/* Flush only modified areas of the framebuffer to the display */
-void ssd1306_flush_dirty(void);
+/*
+ * Flush only modified areas of the framebuffer to the display.
+ * With SSD1306_DOUBLE_BUFFER the frame is first handed over by
+ * ssd1306_swap_buffers() and sent from the front frame.
+ *
+ * All transactions of a flush share one deadline (SSD1306_FLUSH_TIMEOUT)
+ * and the flush stops at the first failed one, returning its status.
+ * The next flush then resends the whole frame. After
+ * SSD1306_LINK_FAIL_LIMIT failed flushes in a row, flushes are held back
+ * and return SSD1306_OFFLINE at once; every SSD1306_LINK_RETRY_MS one of
+ * them recovers the bus (transport recover hook), sets the controller up
+ * again and, if that succeeds, resends the whole frame.
+ */
+ssd1306_status_t ssd1306_flush_dirty(void);
+
+/*
+ * Incremental flush for callers with a time budget: send at most
+ * 'max_bytes' framebuffer bytes (0: no limit) as per-page runs, plus
+ * their addressing commands, and return. The next call resumes where
+ * this one stopped; pixels drawn in between are picked up, whether they
+ * fall on bytes already sent or not. Returns 1 while dirty data remains,
+ * 0 once the panel shows the framebuffer, and also
+ * while flushes are held back after failures (see ssd1306_flush_status()).
+ * With SSD1306_DOUBLE_BUFFER a new frame is swapped in only after the
+ * previous one has been sent completely.
+ */
+uint8_t ssd1306_flush_step(uint16_t max_bytes);
+
+/*
+ * Same as ssd1306_flush_step(), additionally starting no new block once
+ * ssd1306_time_ticks_ms() reaches 'deadline_ms'. The deadline is checked
+ * between blocks, so a call can overrun it by one block (at most one
+ * page width, or 'max_bytes').
+ */
+uint8_t ssd1306_flush_step_ex(uint16_t max_bytes, uint32_t deadline_ms);
+
+/* Status of the last flush or flush step: SSD1306_OK, the error that
+ * stopped it, or SSD1306_OFFLINE while flushes are held back */
+ssd1306_status_t ssd1306_flush_status(void);
+
+/*
+ * Start continuous hardware scrolling of framebuffer pages page0..page1
+ * (rows page0 * 8 to page1 * 8 + 7, on display rows shifted by
+ * ssd1306_buffer_scroll_rows()), one column per 'interval'
+ * (SSD1306_SCROLL_FRAMES_*) in direction 'dir' (SSD1306_SCROLL_RIGHT /
+ * SSD1306_SCROLL_LEFT), wrapping around. Pending changes are flushed
+ * first. While the pages scroll the controller moves them without any
+ * bus traffic, and flushes leave them alone: what is drawn there is sent
+ * once ssd1306_scroll_stop() has been called. A running scroll is
+ * stopped first; setting the controller up again after failures (see
+ * ssd1306_flush_dirty()) stops it too.
+ */
+ssd1306_status_t ssd1306_scroll_start(uint8_t page0, uint8_t page1, uint8_t dir, uint8_t interval);
+
+/*
+ * Same as ssd1306_scroll_start(), additionally moving the whole display
+ * up by 'vertical' rows (1..63) per step (diagonal scroll); 'vertical' =
+ * 0 scrolls horizontally only.
+ */
+ssd1306_status_t ssd1306_scroll_start_ex(uint8_t page0,
+                                         uint8_t page1,
+                                         uint8_t dir,
+                                         uint8_t interval,
+                                         uint8_t vertical);
+
+/*
+ * Stop hardware scrolling. The controller leaves the scrolled pages
+ * shifted by however far they had moved, so they are marked dirty and the
+ * next flush rewrites them from the framebuffer.
+ */
+void ssd1306_scroll_stop(void);
+
+/* Non-zero while hardware scrolling is running */
+uint8_t ssd1306_scroll_active(void);
+
+/* Non-zero while an asynchronous transport is still sending (0 for
+ * blocking transports) */
+uint8_t ssd1306_busy(void);
+
+/* Wait until the transport has sent everything; returns its status. An
+ * error counts as a failed flush (see ssd1306_flush_dirty()) */
+ssd1306_status_t ssd1306_wait_idle(void);
+
+#ifdef SSD1306_DOUBLE_BUFFER
+/*
+ * Hand the drawn frame over to the front frame: its dirty bytes are
+ * copied there and the dirty flags move with them, leaving the
+ * framebuffer clean and free for drawing the next frame. Cost is
+ * proportional to the dirty area, not to the transfer, but a transport
+ * still sending the front frame in place is waited for first.
+ */
+void ssd1306_swap_buffers(void);
+#endif
 
 #endif /* SSD1306_H */
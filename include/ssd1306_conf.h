@@ -28,6 +28,13 @@
 #define SSD1306_MCU_STM32F1
 // #define SSD1306_MCU_STM32L1
 
+/*
+ * Build for a desktop OS instead (usually passed as -DSSD1306_MCU_HOST).
+ * Takes precedence over the MCU family: ssd1306_init() then records the
+ * byte stream through ssd1306_transport_host (ssd1306_port_host.h).
+ */
+// #define SSD1306_MCU_HOST
+
 /* Integration hooks (delay, watchdog)
  * Implement these functions in user code; the macros below map library
  * calls to your implementations.
@@ -57,6 +64,116 @@ void ssd1306_port_watchdog_feed(void);
 /* I2C operation timeout, in milliseconds */
 #define SSD1306_I2C_TIMEOUT   100
 
+/*
+ * SCL/SDA pins of the bus (I2C2: PB10/PB11). When set, bus recovery after
+ * failed flushes first releases a display that holds SDA low, by driving
+ * up to nine SCL pulses and a STOP as GPIO, before it resets the I2C
+ * peripheral; otherwise only the peripheral is reset.
+ */
+// #define SSD1306_I2C_SCL_GPIO  GPIOB
+// #define SSD1306_I2C_SCL_PIN   10
+// #define SSD1306_I2C_SDA_GPIO  GPIOB
+// #define SSD1306_I2C_SDA_PIN   11
+
+/*
+ * Send over DMA instead of polling. Transactions are copied into a queue
+ * and transmitted in the background, so ssd1306_flush_dirty() returns as
+ * soon as its blocks are queued. Call ssd1306_port_dma_irq_handler() from
+ * the IRQ handler of the DMA channel below and enable that IRQ in the NVIC.
+ * STM32F1/L1: I2C1_TX is DMA1 channel 6, I2C2_TX is DMA1 channel 4.
+ */
+// #define SSD1306_I2C_USE_DMA
+#define SSD1306_I2C_DMA               DMA1
+#define SSD1306_I2C_DMA_CHANNEL       DMA1_Channel4
+#define SSD1306_I2C_DMA_CHANNEL_NUM   4
+
+/*
+ * Send from I2C event/error interrupts instead of polling, for when no DMA
+ * channel is free: transactions are queued as with SSD1306_I2C_USE_DMA and
+ * the CPU only services one interrupt per bus event. Call
+ * ssd1306_port_i2c_ev_irq_handler() and ssd1306_port_i2c_er_irq_handler()
+ * from I2Cx_EV_IRQHandler / I2Cx_ER_IRQHandler and enable both IRQs in
+ * the NVIC. SSD1306_I2C_USE_DMA takes precedence.
+ */
+// #define SSD1306_I2C_USE_IT
+
+
+/* =====================================================================
+ * SPI interface (4-wire)
+ * ===================================================================== */
+
+/*
+ * Talk to the display over 4-wire SPI instead of I2C. The application
+ * sets up the SPI peripheral (master, mode 0, 8-bit, MSB first, up to
+ * 10 MHz) and the pins (push-pull outputs); the driver drives DC
+ * (command/data), CS (one transaction at a time) and pulses RST in
+ * ssd1306_init(). Leave SSD1306_SPI_RST_GPIO undefined when RES# is
+ * driven by a reset circuit.
+ */
+// #define SSD1306_USE_SPI
+#define SSD1306_SPI_PORT      SPI1
+#define SSD1306_SPI_TIMEOUT   100
+#define SSD1306_SPI_DC_GPIO   GPIOA
+#define SSD1306_SPI_DC_PIN    3
+#define SSD1306_SPI_CS_GPIO   GPIOA
+#define SSD1306_SPI_CS_PIN    4
+#define SSD1306_SPI_RST_GPIO  GPIOA
+#define SSD1306_SPI_RST_PIN   2
+
+/*
+ * Send over DMA instead of polling, as with SSD1306_I2C_USE_DMA.
+ * STM32F1/L1: SPI1_TX is DMA1 channel 3, SPI2_TX is DMA1 channel 5.
+ */
+// #define SSD1306_SPI_USE_DMA
+#define SSD1306_SPI_DMA               DMA1
+#define SSD1306_SPI_DMA_CHANNEL       DMA1_Channel3
+#define SSD1306_SPI_DMA_CHANNEL_NUM   3
+
+/* Transaction queue RAM (DMA or interrupt-driven transport): a full frame
+ * with its addressing fits without waiting. With SSD1306_DOUBLE_BUFFER
+ * frame data is sent in place, so a few hundred bytes are enough */
+#define SSD1306_PORT_QUEUE_BYTES      1152
+#define SSD1306_PORT_QUEUE_DEPTH      16
+
+/* The queue interrupts start the next transaction themselves; each bus
+ * wait in there (START, address, last byte) gives up after this long,
+ * and a failed start drops the rest of the batch */
+#define SSD1306_PORT_IRQ_WAIT_US      250
+
+
+/*
+ * Count bus transactions and bytes (ssd1306_stats, see ssd1306_priv.h),
+ * including per-flush totals. Costs a few increments per transfer.
+ */
+// #define SSD1306_STATS
+
+/*
+ * Flush cost model, in bus byte-times. The fixed overhead of one write
+ * transaction comes from the active transport (transaction_cost: 3 for
+ * I2C, 2 for SPI); SSD1306_COST_TRANSACTION overrides it. A clean gap
+ * between two dirty runs of a page is re-sent instead of re-addressed
+ * when it is at most SSD1306_FLUSH_GAP_MAX bytes long, and a 0x21/0x22
+ * window costs SSD1306_COST_WINDOW; both are derived from the
+ * transaction cost at flush time unless set here (a gap of 0 disables
+ * merging).
+ */
+// #define SSD1306_COST_TRANSACTION   3
+// #define SSD1306_FLUSH_GAP_MAX      8
+// #define SSD1306_COST_WINDOW        21
+
+/*
+ * Failure handling. All transactions of one flush share a deadline of
+ * SSD1306_FLUSH_TIMEOUT ms (size it for a full frame on your bus: about
+ * 25 ms at 400 kHz I2C, 100 ms at 100 kHz), and a flush stops at its
+ * first failed transaction. After SSD1306_LINK_FAIL_LIMIT failed flushes
+ * in a row flushes are held back, and every SSD1306_LINK_RETRY_MS one of
+ * them recovers the bus and sets the display up again. With DMA or
+ * interrupts, failures are seen by ssd1306_wait_idle().
+ */
+// #define SSD1306_FLUSH_TIMEOUT      250
+// #define SSD1306_LINK_FAIL_LIMIT    3
+// #define SSD1306_LINK_RETRY_MS      1000
+
 
 /* =====================================================================
  * Character encoding and fonts
@@ -86,6 +203,46 @@ void ssd1306_port_watchdog_feed(void);
  */
 #define SSD1306_FONT_DEFAULT   SSD1306_FONT_7x14
 
+/*
+ * Store built-in fonts in the controller's page-major (GRAM) layout.
+ * Glyphs are then blitted without transposition; at y multiple of 8 they
+ * are a straight byte copy. The arrays are generated from the row-major
+ * ones by tools/ssd1306_fontconv.c.
+ */
+// #define SSD1306_FONT_USE_PAGE_MAJOR
+
+
+/*
+ * Keep a second (front) framebuffer that the flush transmits from.
+ * ssd1306_swap_buffers() hands a finished frame over, so the next frame
+ * can be drawn while the previous one is still being sent. The DMA and
+ * interrupt-driven transports send it in place instead of copying it
+ * into their queue; the next swap waits until they are done with it.
+ * Costs SSD1306_BUFFER_SIZE + dirty flags of RAM (about 1.2 KB at 128x64),
+ * part of which a smaller SSD1306_PORT_QUEUE_BYTES gives back.
+ */
+// #define SSD1306_DOUBLE_BUFFER
+
+
+/*
+ * Skip bytes the panel already shows. SSD1306_SHADOW_GRAM keeps a copy of
+ * the panel's GRAM (SSD1306_BUFFER_SIZE bytes of RAM) and the flush sends
+ * only bytes that differ from it. SSD1306_SHADOW_HASH keeps a 32-bit hash
+ * per page (32 bytes of RAM at 128x64) and skips dirty pages whose content
+ * hashes the same as last sent; pages are compared whole, and a hash
+ * collision leaves a page stale until it changes again.
+ * Define at most one of them.
+ */
+// #define SSD1306_SHADOW_GRAM
+// #define SSD1306_SHADOW_HASH
+
+
+/*
+ * Depth of the clip rectangle stack (ssd1306_clip_push / ssd1306_clip_pop).
+ * Each level costs 8 bytes of RAM.
+ */
+#define SSD1306_CLIP_STACK_DEPTH   4
+
 
 /* =====================================================================
  * Display type and geometry
@@ -126,5 +283,23 @@ void ssd1306_port_watchdog_feed(void);
  */
 #define SSD1306_UI_AUTO_FLUSH_DEFAULT   1
 
+/*
+ * Scroll menus with the display start line (ssd1306_buffer_scroll_rows):
+ * when visible_offset has moved since the last ssd1306_ui_draw_menu(),
+ * the picture moves along with the items and the items still in view are
+ * not repainted. The header, the bands around the menu, the rows
+ * scrolled into view and rows whose highlight changes then go out on
+ * re-aligned pages, so the shift is only taken where it is estimated to
+ * send less than repainting in place. Payload bytes per one-item scroll
+ * on the host transport, 10 items, scrolling from start line 0:
+ *   8x8 font, no header, spacing 0, no padding:    1024 -> 298 (16 tx)
+ *   7x14 font, no header, spacing 1, padding 4:     482 -> 454
+ *   demo menu (7x14, "Menu" header, spacing 1,
+ *   padding 4):                                     708 -> 708 (no shift)
+ * The whole display moves: for menus that own the screen, on 64-row
+ * panels. Call ssd1306_ui_menu_invalidate() after drawing over a menu.
+ */
+// #define SSD1306_UI_MENU_START_LINE
+
 
 #endif /* SSD1306_CONF_H */
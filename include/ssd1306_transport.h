@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Даниил Еремеев
+ * See LICENSE file for details.
+ */
+
+/*
+ * @file ssd1306_transport.h
+ * @brief Transport interface between the driver and the bus.
+ *
+ * The driver talks to the controller only through an ssd1306_transport_t,
+ * selected by ssd1306_init_ex() (ssd1306_init() uses the platform's
+ * default). A transport for another MCU, another bus or a test rig fills
+ * in the function pointers; optional ones may be NULL.
+ */
+
+#ifndef SSD1306_TRANSPORT_H
+#define SSD1306_TRANSPORT_H
+
+#include <stdint.h>
+#include "ssd1306_conf.h"
+
+/*
+ * Driver status codes
+ */
+typedef enum {
+	SSD1306_OK = 0,
+	SSD1306_ERR,
+	SSD1306_TIMEOUT,
+	SSD1306_BUSY,
+	SSD1306_OFFLINE,	/* flushes held back after repeated failures */
+	SSD1306_NACK	/* the display did not acknowledge (I2C) */
+} ssd1306_status_t;
+
+/* One segment of a gathered write */
+typedef struct {
+	const uint8_t *data;
+	uint16_t       size;
+} ssd1306_iovec_t;
+
+typedef struct {
+	/* Bring the bus (and platform timing) up; optional */
+	ssd1306_status_t (*init)(void *ctx);
+
+	/* One data transaction: 'count' segments sent back to back, read in
+	 * place; they may change as soon as the call returns */
+	ssd1306_status_t (*write)(void *ctx, const ssd1306_iovec_t *iov, uint8_t count);
+
+	/* One command transaction of 'count' command bytes */
+	ssd1306_status_t (*write_cmds)(void *ctx, const uint8_t *cmds, uint16_t count);
+
+	/* Called before the first transaction of each flush, flush step or
+	 * controller setup: all of its transactions share one deadline
+	 * 'timeout_ms' from now, and fail fast once it has passed; optional */
+	void (*flush_begin)(void *ctx, uint32_t timeout_ms);
+
+	/* Called after the last transaction of each of them; optional */
+	void (*flush_complete)(void *ctx);
+
+	/* Asynchronous transports: non-zero while transactions are still
+	 * being sent, and wait until they are, returning the first error
+	 * since the previous wait_idle() (each error is reported once);
+	 * optional */
+	uint8_t (*busy)(void *ctx);
+	ssd1306_status_t (*wait_idle)(void *ctx);
+
+	/* Bring the bus back after the display stopped answering: drop
+	 * queued transactions, release a bus held by the slave, reset the
+	 * peripheral. Called before the driver probes the display again;
+	 * optional */
+	ssd1306_status_t (*recover)(void *ctx);
+
+	/* Passed to every function above */
+	void *ctx;
+
+	/* Bus bytes each transaction adds to its payload (ssd1306_stats) */
+	uint8_t framing_bytes;
+
+	/* Same as write, for segments that stay unchanged until busy()
+	 * reports idle (the front frame with SSD1306_DOUBLE_BUFFER): an
+	 * asynchronous transport may send them in place instead of copying
+	 * them; optional, write is used instead */
+	ssd1306_status_t (*write_stable)(void *ctx, const ssd1306_iovec_t *iov, uint8_t count);
+
+	/* Fixed cost of one write transaction in bus byte-times, beyond its
+	 * payload (START, address, control byte and STOP on I2C; CS/DC
+	 * switch on SPI): the flush planner weighs addressing against
+	 * re-sending clean bytes with it (see SSD1306_COST_TRANSACTION) */
+	uint8_t transaction_cost;
+} ssd1306_transport_t;
+
+/* Transport used by ssd1306_init() */
+#ifdef SSD1306_MCU_HOST
+extern const ssd1306_transport_t ssd1306_transport_host;
+#define SSD1306_TRANSPORT_DEFAULT ssd1306_transport_host
+#else
+extern const ssd1306_transport_t ssd1306_transport_stm32;
+#define SSD1306_TRANSPORT_DEFAULT ssd1306_transport_stm32
+#endif
+
+#endif /* SSD1306_TRANSPORT_H */
@@ -184,6 +184,11 @@ typedef struct {
 	SSD1306_TextAlign_t			alignment;       /* Text alignment for items */
 	SSD1306_Padding_t			padding;         /* Inner padding for menu area */
 	SSD1306_Scrollbar_t			scrollbar;       /* Scrollbar descriptor */
+#ifdef SSD1306_UI_MENU_START_LINE
+	uint8_t						drawn_offset;    /* visible_offset on screen (0xFF: not drawn) */
+	uint8_t						drawn_selected;  /* selected_index on screen */
+	uint32_t					drawn_fill;      /* buffer fill count when drawn */
+#endif
 } SSD1306_Menu_t;
 
 /* Helper structure for layout calculation (internal use in .c) */
@@ -215,4 +220,10 @@ void ssd1306_ui_menu_scroll_up(SSD1306_Menu_t *menu);
 /* Scroll menu selection down (and update internal offset as needed) */
 void ssd1306_ui_menu_scroll_down(SSD1306_Menu_t *menu);
 
+/* Forget what the menu has on screen, after drawing over it or moving
+ * the picture: the next ssd1306_ui_draw_menu() repaints it whole.
+ * ssd1306_buffer_fill() and ssd1306_display_clear() do this for every
+ * menu. */
+void ssd1306_ui_menu_invalidate(SSD1306_Menu_t *menu);
+
 #endif /* SSD1306_UI_H */
@@ -39,6 +39,14 @@
 #define SSD1306_CMD_SET_LOW_COLUMN             0x00
 #define SSD1306_CMD_SET_HIGH_COLUMN            0x10
 
+/* --- Column / page window (horizontal and vertical addressing modes)
+ * 0x21, start, end: column range 0..127
+ * 0x22, start, end: page range 0..7
+ * The write pointer moves to the window start and wraps inside it.
+ */
+#define SSD1306_CMD_SET_COLUMN_ADDR            0x21
+#define SSD1306_CMD_SET_PAGE_ADDR              0x22
+
 /* --- COM (row) scan direction
  * 0xC0: scan from COM0 to COM[N-1]
  * 0xC8: scan from COM[N-1] to COM0
@@ -66,6 +74,26 @@
 #define SSD1306_CHARGE_PUMP_ENABLE             0x14
 #define SSD1306_CHARGE_PUMP_DISABLE            0x10
 
+/* --- Display start line: 0x40 | line (0..63), GRAM row shown first --- */
+#define SSD1306_CMD_SET_START_LINE             0x40
+
+/* --- Continuous scrolling
+ * 0x26 / 0x27, 0x00, start page, interval, end page, 0x00, 0xFF:
+ *   horizontal scroll of a page range, right / left
+ * 0x29 / 0x2A, 0x00, start page, interval, end page, vertical offset:
+ *   vertical and right / left horizontal scroll
+ * 0xA3, fixed rows, scrolled rows: vertical scroll area
+ * Scrolling must be deactivated before a new setup is sent, and the
+ * scrolled GRAM content rewritten after it has been deactivated.
+ */
+#define SSD1306_CMD_SCROLL_RIGHT               0x26
+#define SSD1306_CMD_SCROLL_LEFT                0x27
+#define SSD1306_CMD_SCROLL_VERTICAL_RIGHT      0x29
+#define SSD1306_CMD_SCROLL_VERTICAL_LEFT       0x2A
+#define SSD1306_CMD_SET_VERTICAL_SCROLL_AREA   0xA3
+#define SSD1306_CMD_SCROLL_DEACTIVATE          0x2E
+#define SSD1306_CMD_SCROLL_ACTIVATE            0x2F
+
 /* --- Entire display on/off (RAM ignore) --- */
 #define SSD1306_CMD_DISPLAY_ALL_ON_RESUME      0xA4
 #define SSD1306_CMD_DISPLAY_ALL_ON             0xA5
@@ -9,16 +9,27 @@
 
 #include "ssd1306_conf.h"
 
+// Раскладка битмапов символов в массиве шрифта
+typedef enum {
+	// Построчно: строки сверху вниз, старший бит = левый пиксель
+	SSD1306_FONT_LAYOUT_ROW_MAJOR = 0,
+	// Как в GRAM SSD1306: для каждой страницы (8 строк) столбцы слева направо,
+	// бит 0 = верхняя строка страницы; символ = width * ceil(height / 8) байт
+	SSD1306_FONT_LAYOUT_PAGE_MAJOR = 1
+} SSD1306_FontLayout_t;
+
 // Структура шрифта для дисплея
 typedef struct {
 	const uint8_t width;           // Ширина символа в пикселях
 	const uint8_t height;          // Высота символа в пикселях
 	const uint8_t *const data;     // Указатель на массив битмапов символов
+	const uint8_t layout;          // Раскладка данных (SSD1306_FontLayout_t), 0 = построчно
 } SSD1306_Font_t;
 
 
 #ifdef SSD1306_INCLUDE_FONT_8x8
 	extern const uint8_t FONT_8x8_ARRAY[];
+	extern const uint8_t FONT_8x8_PAGES_ARRAY[];
 	extern const SSD1306_Font_t font_8x8;
 	#define SSD1306_FONT_8x8    (&font_8x8)
 #endif
@@ -28,6 +39,7 @@ typedef struct {
 	// PT Mono
 #ifdef SSD1306_INCLUDE_FONT_7x11
 	extern const uint8_t FONT_7x11_ARRAY[];
+	extern const uint8_t FONT_7x11_PAGES_ARRAY[];
 	extern const SSD1306_Font_t font_7x11;
 	#define SSD1306_FONT_7x11   (&font_7x11)
 #endif
@@ -35,18 +47,21 @@ typedef struct {
 	// PT Mono
 #ifdef SSD1306_INCLUDE_FONT_7x14
 	extern const uint8_t FONT_7x14_ARRAY[];
+	extern const uint8_t FONT_7x14_PAGES_ARRAY[];
 	extern const SSD1306_Font_t font_7x14;
 	#define SSD1306_FONT_7x14   (&font_7x14)
 #endif
 
 #ifdef SSD1306_INCLUDE_FONT_11x21
 	extern const uint8_t FONT_11x21_ARRAY[];
+	extern const uint8_t FONT_11x21_PAGES_ARRAY[];
 	extern const SSD1306_Font_t font_11x21;
 	#define SSD1306_FONT_11x21  (&font_11x21)
 #endif
 
 #ifdef SSD1306_INCLUDE_FONT_16x30
 	extern const uint8_t FONT_16x30_ARRAY[];
+	extern const uint8_t FONT_16x30_PAGES_ARRAY[];
 	extern const SSD1306_Font_t font_16x30;
 #endif
 
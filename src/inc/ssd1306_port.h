@@ -4,50 +4,52 @@
  * See LICENSE file for details.
  */
 
+/*
+ * Platform-neutral part of the port layer. MCU headers are only pulled in
+ * by the backend that needs them (ssd1306_port_stm32.h); everything else
+ * reaches the bus through ssd1306_transport (ssd1306_transport.h).
+ */
+
 #ifndef SSD1306_PORT_H
 #define SSD1306_PORT_H
 
 #include <stdint.h>
 #include "ssd1306_conf.h"
+#include "ssd1306_transport.h"
 #include "ssd1306_utils.h"
 
-/* MCU-specific includes */
-#if defined(SSD1306_MCU_STM32F1)
-	#include "stm32f1xx.h"
-#elif defined(SSD1306_MCU_STM32L1)
-	#include "stm32l1xx.h"
-#else
-	#error "Define SSD1306_MCU_STM32Fx in ssd1306_conf.h"
-#endif
-
-/*
- * Driver status codes
- */
-typedef enum {
-	SSD1306_OK = 0,
-	SSD1306_ERR,
-	SSD1306_TIMEOUT,
-	SSD1306_BUSY
-} ssd1306_status_t;
-
 /*
- * Minimal bus descriptor (similar to HAL handle)
+ * Transport selection: I2C by default, 4-wire SPI with SSD1306_USE_SPI.
+ * SSD1306_PORT_USE_DMA is set when the selected transport sends over DMA,
+ * SSD1306_PORT_USE_IT when it is driven by I2C interrupts; both send from
+ * a transaction queue (SSD1306_PORT_USE_QUEUE).
+ * The host backend (SSD1306_MCU_HOST) records the byte stream instead.
  */
-typedef struct {
-	I2C_TypeDef *i2c;     /* I2C1 or I2C2 */
-	uint16_t     addr8;   /* address << 1 */
-	uint32_t     timeout; /* timeout in ms */
-} ssd1306_bus_t;
-
-/* Default bus configuration macro */
-#define SSD1306_PORT_SETUP_DEFAULT() \
-	ssd1306_port_init(SSD1306_I2C_PORT, SSD1306_I2C_ADDR, SSD1306_I2C_TIMEOUT)
+#ifndef SSD1306_MCU_HOST
+#if (defined(SSD1306_USE_SPI) && defined(SSD1306_SPI_USE_DMA)) || \
+    (!defined(SSD1306_USE_SPI) && defined(SSD1306_I2C_USE_DMA))
+#define SSD1306_PORT_USE_DMA
+#elif !defined(SSD1306_USE_SPI) && defined(SSD1306_I2C_USE_IT)
+#define SSD1306_PORT_USE_IT
+#endif
+#endif
 
-/* Initialize port handle */
-void ssd1306_port_init(I2C_TypeDef *i2c, uint16_t addr8, uint32_t timeout_ms);
+#if defined(SSD1306_PORT_USE_DMA) || defined(SSD1306_PORT_USE_IT)
+#define SSD1306_PORT_USE_QUEUE
+#ifndef SSD1306_PORT_QUEUE_BYTES
+#define SSD1306_PORT_QUEUE_BYTES     1152
+#endif
+#ifndef SSD1306_PORT_QUEUE_DEPTH
+#define SSD1306_PORT_QUEUE_DEPTH     16
+#endif
+/* Longest single wait inside the queue interrupts (START, address, last byte) */
+#ifndef SSD1306_PORT_IRQ_WAIT_US
+#define SSD1306_PORT_IRQ_WAIT_US     250
+#endif
+#endif
 
-/* Transmit a block over I2C (STOP is always generated) */
-ssd1306_status_t ssd1306_port_i2c_write(const uint8_t *data, uint16_t size);
+/* Transport the driver is talking through (set by ssd1306_init_ex) */
+extern const ssd1306_transport_t *ssd1306_transport;
 
 /* Platform-specific watchdog hook */
 void ssd1306_port_watchdog_feed(void);
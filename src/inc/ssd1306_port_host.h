@@ -0,0 +1,44 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Даниил Еремеев
+ * See LICENSE file for details.
+ */
+
+/*
+ * Host backend of the port layer (ssd1306_port_host.c, SSD1306_MCU_HOST):
+ * runs the driver on a desktop OS and records the byte stream it would
+ * send to the controller. Exposed as ssd1306_transport_host.
+ *
+ * Record format, one record per bus transaction:
+ *   control (1 byte), payload length (2 bytes, little-endian), payload.
+ * control is 0x00 for a command transaction and 0x40 for a data one; the
+ * end of every flush, flush step, controller setup or scroll start is
+ * marked by a 0xFF record without payload. tools/ssd1306_replay.c decodes a recording.
+ */
+
+#ifndef SSD1306_PORT_HOST_H
+#define SSD1306_PORT_HOST_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "ssd1306_port.h"
+
+#define SSD1306_HOST_REC_COMMANDS  0x00u
+#define SSD1306_HOST_REC_DATA      0x40u
+#define SSD1306_HOST_REC_FLUSH     0xFFu
+
+typedef struct {
+	FILE            *out;          /* recording (file or pipe); NULL: count only */
+	uint32_t         transactions; /* transactions written */
+	uint32_t         bytes;        /* payload bytes written */
+	uint32_t         flushes;      /* flush markers written */
+	ssd1306_status_t status;       /* first write error, or SSD1306_OK */
+	uint8_t          offline;      /* non-zero: writes fail unrecorded, as with
+	                                * a disconnected display */
+	uint32_t         recoveries;   /* recover() calls */
+} ssd1306_host_t;
+
+/* State of ssd1306_transport_host; set 'out' before ssd1306_init() */
+extern ssd1306_host_t ssd1306_host;
+
+#endif /* SSD1306_PORT_HOST_H */
@@ -0,0 +1,175 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Даниил Еремеев
+ * See LICENSE file for details.
+ */
+
+/*
+ * STM32F1/L1 backend of the port layer (ssd1306_port.c): register-level
+ * I2C or 4-wire SPI, polled, over DMA or (I2C) interrupt-driven. Exposed
+ * to the driver as ssd1306_transport_stm32.
+ */
+
+#ifndef SSD1306_PORT_STM32_H
+#define SSD1306_PORT_STM32_H
+
+#include <stdint.h>
+#include "ssd1306_port.h"
+
+/* MCU-specific includes */
+#if defined(SSD1306_MCU_STM32F1)
+	#include "stm32f1xx.h"
+#elif defined(SSD1306_MCU_STM32L1)
+	#include "stm32l1xx.h"
+#else
+	#error "Define SSD1306_MCU_STM32Fx in ssd1306_conf.h"
+#endif
+
+#ifdef SSD1306_USE_SPI
+
+#ifdef SSD1306_PORT_USE_DMA
+#ifndef SSD1306_SPI_DMA
+#define SSD1306_SPI_DMA              DMA1
+#endif
+#ifndef SSD1306_SPI_DMA_CHANNEL
+#define SSD1306_SPI_DMA_CHANNEL      DMA1_Channel3
+#define SSD1306_SPI_DMA_CHANNEL_NUM  3
+#endif
+#define SSD1306_PORT_DMA             SSD1306_SPI_DMA
+#define SSD1306_PORT_DMA_CHANNEL     SSD1306_SPI_DMA_CHANNEL
+#define SSD1306_PORT_DMA_CHANNEL_NUM SSD1306_SPI_DMA_CHANNEL_NUM
+#endif
+
+/* Bus bytes a transaction adds to its payload: none, framing is CS/DC */
+#define SSD1306_PORT_TX_OVERHEAD     0U
+/* Byte-times a transaction costs beyond its payload: CS/DC switch, wait
+ * for the last byte to leave the shift register */
+#define SSD1306_PORT_TX_COST         2U
+
+#else /* I2C */
+
+#ifdef SSD1306_PORT_USE_DMA
+#ifndef SSD1306_I2C_DMA
+#define SSD1306_I2C_DMA              DMA1
+#endif
+#ifndef SSD1306_I2C_DMA_CHANNEL
+#define SSD1306_I2C_DMA_CHANNEL      DMA1_Channel4
+#define SSD1306_I2C_DMA_CHANNEL_NUM  4
+#endif
+#define SSD1306_PORT_DMA             SSD1306_I2C_DMA
+#define SSD1306_PORT_DMA_CHANNEL     SSD1306_I2C_DMA_CHANNEL
+#define SSD1306_PORT_DMA_CHANNEL_NUM SSD1306_I2C_DMA_CHANNEL_NUM
+#endif
+
+/* Bus bytes a transaction adds to its payload: address + control byte */
+#define SSD1306_PORT_TX_OVERHEAD     2U
+/* Byte-times a transaction costs beyond its payload: START, address,
+ * control byte, STOP */
+#define SSD1306_PORT_TX_COST         3U
+
+#endif /* SSD1306_USE_SPI */
+
+/*
+ * Minimal bus descriptor (similar to HAL handle)
+ */
+typedef struct {
+#ifdef SSD1306_USE_SPI
+	SPI_TypeDef *spi;     /* SPI1 or SPI2 */
+#else
+	I2C_TypeDef *i2c;     /* I2C1 or I2C2 */
+	uint16_t     addr8;   /* address << 1 */
+#endif
+	uint32_t     timeout; /* timeout in ms */
+} ssd1306_bus_t;
+
+#ifdef SSD1306_USE_SPI
+
+/* Default bus configuration macro */
+#define SSD1306_PORT_SETUP_DEFAULT() \
+	ssd1306_port_init(SSD1306_SPI_PORT, SSD1306_SPI_TIMEOUT)
+
+/* Initialize port handle, idle CS/DC and reset the controller (RST pin) */
+void ssd1306_port_init(SPI_TypeDef *spi, uint32_t timeout_ms);
+
+#else
+
+/* Default bus configuration macro */
+#define SSD1306_PORT_SETUP_DEFAULT() \
+	ssd1306_port_init(SSD1306_I2C_PORT, SSD1306_I2C_ADDR, SSD1306_I2C_TIMEOUT)
+
+/* Initialize port handle */
+void ssd1306_port_init(I2C_TypeDef *i2c, uint16_t addr8, uint32_t timeout_ms);
+
+#endif
+
+/*
+ * Transmit one transaction: 'count' segments, read in place, framed by
+ * the SSD1306 control byte 'control' (0x00: commands, 0x40: data). Over
+ * I2C the control byte follows the address and STOP is always generated;
+ * over SPI its D/C# bit drives the DC pin and CS frames the transaction.
+ * With SSD1306_PORT_USE_QUEUE (DMA or interrupt-driven) the transaction
+ * is queued and sent in the background; the call returns once it is
+ * queued.
+ */
+ssd1306_status_t ssd1306_port_writev(uint8_t control, const ssd1306_iovec_t *iov, uint8_t count);
+
+/* Transmit a ready-made packet (control byte first) */
+ssd1306_status_t ssd1306_port_write(const uint8_t *data, uint16_t size);
+
+/*
+ * Bring the bus back after the display stopped answering: drop queued
+ * transactions, then over I2C clock out a display holding SDA low
+ * (SSD1306_I2C_SCL_GPIO) and reset the peripheral; over SPI pulse RST.
+ * Returns SSD1306_BUSY while the I2C bus is still not free.
+ */
+ssd1306_status_t ssd1306_port_recover(void);
+
+#ifdef SSD1306_PORT_USE_QUEUE
+
+/* Called when the transport leaves idle, from the caller's context */
+typedef void (*ssd1306_port_start_cb_t)(void *ctx);
+
+/*
+ * Called when every queued transaction has been sent, usually from the
+ * DMA or I2C interrupt. 'status' is the first error since the transport
+ * left idle, or SSD1306_OK.
+ */
+typedef void (*ssd1306_port_complete_cb_t)(ssd1306_status_t status, void *ctx);
+
+/* Install start/complete callbacks (either may be NULL) */
+void ssd1306_port_set_callbacks(ssd1306_port_start_cb_t on_start,
+                                ssd1306_port_complete_cb_t on_complete,
+                                void *ctx);
+
+/*
+ * Like ssd1306_port_writev(), for segments the caller leaves unchanged
+ * until ssd1306_port_busy() reports idle: when they follow each other in
+ * memory they are sent in place, without a copy into the queue.
+ */
+ssd1306_status_t ssd1306_port_writev_stable(uint8_t control, const ssd1306_iovec_t *iov, uint8_t count);
+
+/* Non-zero while queued transactions are being sent */
+uint8_t ssd1306_port_busy(void);
+
+/* Wait until the queue has drained; returns the first error since the
+ * previous call, or SSD1306_OK */
+ssd1306_status_t ssd1306_port_wait_idle(void);
+
+#endif /* SSD1306_PORT_USE_QUEUE */
+
+#ifdef SSD1306_PORT_USE_DMA
+
+/* Call from the IRQ handler of the transport's DMA channel */
+void ssd1306_port_dma_irq_handler(void);
+
+#endif /* SSD1306_PORT_USE_DMA */
+
+#ifdef SSD1306_PORT_USE_IT
+
+/* Call from I2Cx_EV_IRQHandler and I2Cx_ER_IRQHandler of the display's bus */
+void ssd1306_port_i2c_ev_irq_handler(void);
+void ssd1306_port_i2c_er_irq_handler(void);
+
+#endif /* SSD1306_PORT_USE_IT */
+
+#endif /* SSD1306_PORT_STM32_H */
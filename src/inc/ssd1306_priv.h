@@ -15,6 +15,8 @@
 
 #include <stdint.h>
 #include "ssd1306_conf.h"
+#include "ssd1306.h"
+#include "ssd1306_port.h"
 
 /* =====================================================================
  * Display type and geometry
@@ -60,6 +62,13 @@
 /* Dirty flags array size (1 bit per framebuffer byte) */
 #define SSD1306_DIRTY_FLAGS_SIZE ((SSD1306_WIDTH / 8) * (SSD1306_HEIGHT / 8))
 
+/* Number of display pages (rows of 8 pixels) */
+#define SSD1306_PAGES            (SSD1306_HEIGHT / 8)
+
+/* Controller GRAM geometry, independent of the visible panel area */
+#define SSD1306_GRAM_COLUMNS     128
+#define SSD1306_GRAM_PAGES       8
+
 /* Column offset split into low/high nibbles for commands */
 #define SSD1306_X_OFFSET_LOWER   (SSD1306_X_OFFSET & 0x0F)
 #define SSD1306_X_OFFSET_UPPER   ((SSD1306_X_OFFSET >> 4) & 0x07)
@@ -69,21 +78,185 @@
  * -------------------------------------------------------------------------- */
 
 typedef struct {
-	uint16_t cursor_x;    /* current X position in pixels */
-	uint16_t cursor_y;    /* current Y position in pixels */
 	uint8_t  initialized; /* display initialization flag */
 	uint8_t  display_on;  /* display on/off flag */
+	uint8_t  addr_mode;   /* programmed memory addressing mode (SSD1306_ADDR_MODE_*) */
+	uint8_t  gram_valid;  /* pointer and window below match the controller */
+	uint8_t  gram_page;   /* controller write pointer: GRAM page (offset applied) */
+	uint8_t  gram_column; /* controller write pointer: GRAM column (offset applied) */
+	uint8_t  win_page_start; /* 0x22 page window, GRAM coordinates */
+	uint8_t  win_page_end;
+	uint8_t  win_col_start;  /* 0x21 column window, GRAM coordinates */
+	uint8_t  win_col_end;
+	uint8_t  shadow_valid;   /* GRAM shadow / page hashes reflect the panel */
+	uint8_t  flush_page;     /* ssd1306_flush_step() resume point */
+	uint8_t  flush_column;
+	uint8_t  contrast;       /* restored when the controller is set up again */
+	uint8_t  inverted;
+	uint8_t  resync;         /* GRAM content lost: resend the whole frame */
+	uint8_t  link_failures;  /* failed flushes in a row */
+	uint8_t  link_down;      /* flushes held back until link_retry_ms */
+	uint32_t link_retry_ms;
+	uint8_t  scroll_active;  /* hardware scroll running: its pages are not flushed */
+	uint8_t  scroll_page0;   /* scrolled framebuffer pages */
+	uint8_t  scroll_page1;
+	uint8_t  scroll_vertical; /* diagonal scroll: rows per step */
+	uint8_t  start_line;     /* framebuffer row shown as display row 0 */
+#ifdef SSD1306_DOUBLE_BUFFER
+	uint8_t  front_start_line; /* start_line of the front frame */
+#endif
+	uint8_t  gram_start_line; /* start line programmed, 0xFF: unknown */
+#ifdef SSD1306_UI_MENU_START_LINE
+	uint32_t fill_count;     /* ssd1306_buffer_fill() calls: whatever was
+	                          * drawn before the last one is gone */
+#endif
 } SSD1306_State_t;
 
 /* Global driver state */
 extern SSD1306_State_t ssd1306_state;
 
-/* Framebuffer (graphics RAM shadow) */
+#ifndef SSD1306_CLIP_STACK_DEPTH
+#define SSD1306_CLIP_STACK_DEPTH 4
+#endif
+
+/*
+ * Clip rectangle, inclusive bounds in screen coordinates.
+ * Always lies within the screen; x0 > x1 (or y0 > y1) means nothing
+ * is drawable.
+ */
+typedef struct {
+	int16_t x0;
+	int16_t y0;
+	int16_t x1;
+	int16_t y1;
+} SSD1306_Clip_t;
+
+/* Current clip rectangle, honoured by every drawing primitive */
+extern SSD1306_Clip_t ssd1306_clip;
+
+#ifdef SSD1306_STATS
+/* Bus traffic counters. Bytes include the framing of each write
+ * (I2C address and control byte). */
+typedef struct {
+	uint32_t transactions;            /* I2C write transactions, total */
+	uint32_t bytes;                   /* bytes on the bus, total */
+	uint32_t flushes;                 /* flush_dirty() / flush_step() calls that ran */
+	uint32_t last_flush_transactions; /* transactions of the last flush or step */
+	uint32_t last_flush_bytes;        /* bytes of the last flush or step */
+} SSD1306_Stats_t;
+
+extern SSD1306_Stats_t ssd1306_stats;
+#endif
+
+/*
+ * Flush cost model, in bus byte-times (see ssd1306_conf.h), taken from
+ * the active transport unless set in ssd1306_conf.h. Splitting a page
+ * into two blocks costs a column-address transaction (two command
+ * bytes) plus a new data transaction, so clean gaps up to that size are
+ * re-sent rather than skipped.
+ */
+#ifdef SSD1306_COST_TRANSACTION
+#define SSD1306_TX_COST()        ((uint32_t)(SSD1306_COST_TRANSACTION))
+#else
+#define SSD1306_TX_COST()        ((uint32_t)ssd1306_transport->transaction_cost)
+#endif
+
+#ifdef SSD1306_FLUSH_GAP_MAX
+#define SSD1306_GAP_MAX()        ((uint32_t)(SSD1306_FLUSH_GAP_MAX))
+#else
+#define SSD1306_GAP_MAX()        (2U * SSD1306_TX_COST() + 2U)
+#endif
+
+/* Longest data payload sent in one transaction (the transaction queue
+ * holds a whole transaction) */
+#ifdef SSD1306_PORT_USE_QUEUE
+#define SSD1306_DATA_TX_MAX      (SSD1306_PORT_QUEUE_BYTES - 1U)
+#else
+#define SSD1306_DATA_TX_MAX      0xFFFFU
+#endif
+
+/*
+ * Cost of programming a 0x21/0x22 window and later restoring the default
+ * one: two command transactions carrying 6 and up to 9 command bytes.
+ */
+#ifdef SSD1306_COST_WINDOW
+#define SSD1306_WINDOW_COST()    ((uint32_t)(SSD1306_COST_WINDOW))
+#else
+#define SSD1306_WINDOW_COST()    (2U * SSD1306_TX_COST() + 15U)
+#endif
+
+/* Failure handling (see ssd1306_conf.h) */
+#ifndef SSD1306_FLUSH_TIMEOUT
+#define SSD1306_FLUSH_TIMEOUT    250	/* ms for all transactions of a flush */
+#endif
+#ifndef SSD1306_LINK_FAIL_LIMIT
+#define SSD1306_LINK_FAIL_LIMIT  3	/* failed flushes in a row before holding back */
+#endif
+#ifndef SSD1306_LINK_RETRY_MS
+#define SSD1306_LINK_RETRY_MS    1000	/* ms between attempts to reach the display */
+#endif
+
+/* Framebuffer (graphics RAM shadow). Rows are in GRAM order: display
+ * row y is framebuffer row SSD1306_FB_ROW(y) (see ssd1306_buffer_scroll_rows) */
 extern uint8_t ssd1306_buffer[SSD1306_BUFFER_SIZE];
 
+#define SSD1306_FB_ROW(y) ((uint8_t)(((uint16_t)(y) + ssd1306_state.start_line) % SSD1306_HEIGHT))
+
 /* Dirty flags bitmap (1 bit per framebuffer byte) */
 extern uint8_t ssd1306_dirty_flags[SSD1306_DIRTY_FLAGS_SIZE];
 
+/*
+ * Dirty column extents per page: every dirty bit of a page lies within
+ * ssd1306_dirty_min[page]..ssd1306_dirty_max[page] (inclusive). A clean
+ * page has min > max. Kept in step with ssd1306_dirty_flags by every
+ * writer; code that writes ssd1306_dirty_flags directly must call
+ * ssd1306_dirty_sync_extents() afterwards.
+ */
+extern uint8_t ssd1306_dirty_min[SSD1306_PAGES];
+extern uint8_t ssd1306_dirty_max[SSD1306_PAGES];
+
+#ifdef SSD1306_DOUBLE_BUFFER
+/*
+ * Front frame: framebuffer and dirty set handed over by
+ * ssd1306_swap_buffers(). The flush transmits from here while drawing
+ * continues in ssd1306_buffer (the back frame).
+ */
+extern uint8_t ssd1306_front_buffer[SSD1306_BUFFER_SIZE];
+extern uint8_t ssd1306_front_dirty_flags[SSD1306_DIRTY_FLAGS_SIZE];
+extern uint8_t ssd1306_front_dirty_min[SSD1306_PAGES];
+extern uint8_t ssd1306_front_dirty_max[SSD1306_PAGES];
+
+#define SSD1306_TX_BUFFER      ssd1306_front_buffer
+#define SSD1306_TX_DIRTY_FLAGS ssd1306_front_dirty_flags
+#define SSD1306_TX_DIRTY_MIN   ssd1306_front_dirty_min
+#define SSD1306_TX_DIRTY_MAX   ssd1306_front_dirty_max
+#define SSD1306_TX_START_LINE  ssd1306_state.front_start_line
+#else
+/* Frame and dirty set the flush transmits from */
+#define SSD1306_TX_BUFFER      ssd1306_buffer
+#define SSD1306_TX_DIRTY_FLAGS ssd1306_dirty_flags
+#define SSD1306_TX_DIRTY_MIN   ssd1306_dirty_min
+#define SSD1306_TX_DIRTY_MAX   ssd1306_dirty_max
+#define SSD1306_TX_START_LINE  ssd1306_state.start_line
+#endif
+
+#if defined(SSD1306_SHADOW_GRAM) && defined(SSD1306_SHADOW_HASH)
+#error "Define only one of SSD1306_SHADOW_GRAM / SSD1306_SHADOW_HASH"
+#endif
+
+#ifdef SSD1306_SHADOW_GRAM
+/* Copy of the panel's GRAM: what was last sent for every byte */
+extern uint8_t ssd1306_gram_shadow[SSD1306_BUFFER_SIZE];
+#endif
+
+#ifdef SSD1306_SHADOW_HASH
+/* FNV-1a hash of each page as the panel shows it; valid only where
+ * ssd1306_page_hash_valid[page] is set (the page was fully sent since)
+ */
+extern uint32_t ssd1306_page_hash[SSD1306_PAGES];
+extern uint8_t ssd1306_page_hash_valid[SSD1306_PAGES];
+#endif
+
 /* --------------------------------------------------------------------------
  * Internal functions
  * -------------------------------------------------------------------------- */
@@ -91,10 +264,32 @@ extern uint8_t ssd1306_dirty_flags[SSD1306_DIRTY_FLAGS_SIZE];
 /* Send a single command byte to SSD1306 */
 void ssd1306_write_command(uint8_t byte);
 
+/* Send 'count' command bytes in one command transaction */
+void ssd1306_write_commands(const uint8_t *cmds, uint16_t count);
+
+/*
+ * Bracket the transactions of a flush, flush step or controller setup.
+ * The transport gets one deadline (SSD1306_FLUSH_TIMEOUT) for all of
+ * them, and once one has failed the rest are skipped instead of each
+ * waiting out its own timeout. ssd1306_bus_flush_complete() returns the
+ * first error since ssd1306_bus_flush_begin(), or SSD1306_OK.
+ */
+void ssd1306_bus_flush_begin(void);
+ssd1306_status_t ssd1306_bus_flush_complete(void);
+
+/*
+ * Send a command with one parameter in a single transaction.
+ * SSD1306_CMD_SET_MEMORY_MODE is recorded in ssd1306_state.addr_mode.
+ */
 void ssd1306_write_command_ex(uint8_t cmd, uint8_t param);
 
-/* Send a data block to SSD1306 (one packet, up to display width) */
-void ssd1306_write_data(uint8_t *buffer, uint16_t buff_size);
+/*
+ * Send a data block to SSD1306 in one transaction, straight from 'buffer',
+ * and advance the tracked GRAM write pointer the way the controller does.
+ * With SSD1306_DOUBLE_BUFFER 'buffer' must lie in the front frame: it may
+ * be sent in place after the call returns.
+ */
+void ssd1306_write_data(const uint8_t *buffer, uint16_t buff_size);
 
 /* Set current page (row of 8 pixels) */
 void ssd1306_set_page(uint8_t page);
@@ -102,9 +297,90 @@ void ssd1306_set_page(uint8_t page);
 /* Set current column */
 void ssd1306_set_column(uint8_t column);
 
-/* Send a block of framebuffer data and clear corresponding dirty flags */
+/*
+ * Move the GRAM write pointer to (page, column), sending only the
+ * addressing commands whose target differs from the tracked pointer.
+ * Nothing is sent when the pointer is already there. A narrowed or
+ * unknown window is reset to the whole GRAM in the same transaction.
+ */
+void ssd1306_gram_seek(uint8_t page, uint8_t column);
+
+/*
+ * Send SSD1306_TX_BUFFER pages page0..page1, columns col0..col1 as one
+ * horizontal-mode transaction through a 0x21/0x22 window, and clear their
+ * dirty flags. The window is left programmed; ssd1306_gram_seek()
+ * restores the default one when needed.
+ */
+void ssd1306_send_window(uint8_t page0, uint8_t page1, uint8_t col0, uint8_t col1);
+
+/* Send a block of SSD1306_TX_BUFFER and clear its dirty flags */
 void ssd1306_send_block(uint8_t x, uint8_t page, uint32_t n_bytes);
 
+/* Mark framebuffer bytes x0..x1 (inclusive) of one page as dirty */
+void ssd1306_dirty_mark_range(uint8_t page, uint8_t x0, uint8_t x1);
+
+/* Clear transmit-side dirty flags (SSD1306_TX_DIRTY_*) of bytes x0..x1
+ * (inclusive) of one page */
+void ssd1306_dirty_clear_range(uint8_t page, uint8_t x0, uint8_t x1);
+
+/* Mark every framebuffer byte dirty */
+void ssd1306_dirty_mark_all(void);
+
+/* Recompute the per-page extents from ssd1306_dirty_flags */
+void ssd1306_dirty_sync_extents(void);
+
+#if defined(SSD1306_SHADOW_GRAM) || defined(SSD1306_SHADOW_HASH)
+/*
+ * Drop transmit-side dirty bytes that would not change the panel.
+ * SSD1306_SHADOW_GRAM compares every dirty byte with the GRAM shadow and
+ * shrinks the extents; SSD1306_SHADOW_HASH drops a dirty page whose hash
+ * equals the valid hash of what the panel shows. With 'trusted' = 0
+ * (GRAM content unknown) nothing is dropped.
+ */
+void ssd1306_dirty_refine(uint8_t trusted);
+#endif
+
+#ifdef SSD1306_SHADOW_HASH
+/*
+ * Record the hash of a page the flush has just sent to. The hash becomes
+ * valid when the page has no dirty bytes left; a page sent only in part
+ * (see ssd1306_flush_step) is invalidated until it is complete.
+ */
+void ssd1306_page_hash_update(uint8_t page);
+#endif
+
+/*
+ * Set (White) or clear (Black) the bits given by 'mask' in framebuffer
+ * bytes x0..x1 (inclusive) of one display page, which lies across two
+ * framebuffer pages unless the start line is a multiple of 8 rows.
+ * Coordinates must be on screen;
+ * the clip rectangle is not applied here.
+ * Only bytes whose value actually changes are marked dirty, with a single
+ * range update per call.
+ */
+void ssd1306_buffer_write_span(uint8_t page,
+                               uint8_t x0,
+                               uint8_t x1,
+                               uint8_t mask,
+                               SSD1306_COLOR_t color);
+
+/*
+ * Blit a page-major 1bpp image (SSD1306 GRAM order) into the framebuffer.
+ * src[page * width + column] holds 8 vertical pixels, bit 0 = top row.
+ * The image is combined with the framebuffer by raster op 'rop' (see
+ * SSD1306_ROP_t), one destination byte at a time.
+ * The image is clipped against the current clip rectangle. For SSD1306_ROP_COPY at
+ * y multiple of 8 whole bytes are copied; otherwise two source pages are
+ * shift-merged into each destination page with masks.
+ */
+void ssd1306_buffer_blit_pages(int16_t x,
+                               int16_t y,
+                               const uint8_t *src,
+                               uint8_t width,
+                               uint8_t height,
+                               SSD1306_COLOR_t color,
+                               SSD1306_ROP_t rop);
+
 /* Iterate over string and decode next character (according to charset) */
 const char* ssd1306_next_char(const char *str, uint16_t *out_codepoint);
 
@@ -48,12 +48,19 @@
 #define SSD1306_CS_BOTTOM  4 /* below viewport */
 #define SSD1306_CS_TOP     8 /* above viewport */
 
-/* Compute outcode for a point relative to current screen bounds. */
+/* Compute outcode for a point relative to the current clip rectangle. */
 uint8_t ssd1306_geom_compute_out_code(int16_t x, int16_t y);
 
 /* Swap two integers by value. */
 void ssd1306_util_swap_int(int *a, int *b);
 
+/*
+ * Transpose an 8x8 bit block from scanline order to SSD1306 column order.
+ * rows[i * stride] is scanline i, MSB = leftmost pixel.
+ * cols[j] receives column j, bit 0 = top scanline.
+ */
+void ssd1306_util_transpose8(const uint8_t *rows, uint16_t stride, uint8_t cols[8]);
+
 /* Delay / timing helpers implemented in ssd1306_utils.c (or user code). */
 void ssd1306_time_init(uint32_t hclk_hz);
 void ssd1306_time_delay_ms(uint32_t ms);
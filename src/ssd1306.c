@@ -35,30 +35,43 @@ void ssd1306_set_display_on(uint8_t on) {
 
 void ssd1306_set_contrast(uint8_t value) {
 	ssd1306_write_command_ex(SSD1306_CMD_SET_CONTRAST, value);
+	ssd1306_state.contrast = value;
 }
 
 void ssd1306_set_invert(uint8_t invert) {
 	if (invert == SSD1306_INVERT_ON) {
 		ssd1306_write_command(SSD1306_CMD_SET_INVERT_DISPLAY);
+		ssd1306_state.inverted = 1;
 	} else if (invert == SSD1306_INVERT_OFF) {
 		ssd1306_write_command(SSD1306_CMD_SET_NORMAL_DISPLAY);
+		ssd1306_state.inverted = 0;
 	}
 }
 
-void ssd1306_init(void) {
-	SystemCoreClockUpdate();
-	ssd1306_time_init(SystemCoreClock);
-	SSD1306_DELAY_MS(100);
+/*
+ * Program the controller from scratch: after power-up, and again when
+ * it answers after failed flushes (it may have lost power). Contrast,
+ * inversion and on/off are taken from ssd1306_state; the framebuffer is
+ * left alone.
+ */
+static ssd1306_status_t ssd1306_controller_setup(void) {
+	uint8_t on = ssd1306_state.display_on;
+
+	ssd1306_bus_flush_begin();
 
-	SSD1306_PORT_SETUP_DEFAULT();
+	/* Controller state is unknown until programmed below */
+	ssd1306_state.gram_valid = 0;
 
 	ssd1306_set_display_on(SSD1306_DISPLAY_OFF);
 
-	ssd1306_write_command(SSD1306_CMD_SET_MEMORY_MODE);
-	ssd1306_write_command(SSD1306_ADDR_MODE_HORIZONTAL);
+	/* A scroll left running would move what the next flush sends */
+	ssd1306_write_command(SSD1306_CMD_SCROLL_DEACTIVATE);
+	ssd1306_state.scroll_active = 0;
 
-	ssd1306_set_page(0);
-	ssd1306_set_column(0);
+	ssd1306_write_command_ex(SSD1306_CMD_SET_MEMORY_MODE, SSD1306_ADDR_MODE_HORIZONTAL);
+
+	/* Programs the whole-GRAM window and the tracked write pointer */
+	ssd1306_gram_seek(0, 0);
 
 #ifdef SSD1306_MIRROR_VERT
 	ssd1306_write_command(SSD1306_CMD_SET_COM_OUTPUT_REMAPPED);
@@ -72,13 +85,9 @@ void ssd1306_init(void) {
 	ssd1306_write_command(SSD1306_CMD_SET_SEGMENT_REMAP_NORMAL);
 #endif
 
-#ifdef SSD1306_INVERSE_COLOR
-	ssd1306_set_invert(SSD1306_INVERT_ON);
-#else
-	ssd1306_set_invert(SSD1306_INVERT_OFF);
-#endif
+	ssd1306_set_invert(ssd1306_state.inverted ? SSD1306_INVERT_ON : SSD1306_INVERT_OFF);
 
-	ssd1306_set_contrast(0xFF);
+	ssd1306_set_contrast(ssd1306_state.contrast);
 
 	ssd1306_write_command(SSD1306_CMD_SET_MULTIPLEX_RATIO);
 #if (SSD1306_HEIGHT == 32) || (SSD1306_HEIGHT == 64) || (SSD1306_HEIGHT == 128)
@@ -92,6 +101,9 @@ void ssd1306_init(void) {
 	ssd1306_write_command(SSD1306_CMD_SET_DISPLAY_OFFSET);
 	ssd1306_write_command(0x00);
 
+	ssd1306_write_command((uint8_t)(SSD1306_CMD_SET_START_LINE | SSD1306_TX_START_LINE));
+	ssd1306_state.gram_start_line = SSD1306_TX_START_LINE;
+
 	ssd1306_write_command(SSD1306_CMD_SET_DISPLAY_CLOCK_DIV);
 	ssd1306_write_command(0x80);
 
@@ -111,12 +123,234 @@ void ssd1306_init(void) {
 	ssd1306_write_command(SSD1306_CMD_SET_CHARGE_PUMP);
 	ssd1306_write_command(SSD1306_CHARGE_PUMP_ENABLE);
 
-	ssd1306_set_display_on(SSD1306_DISPLAY_ON);
+	if (on) {
+		ssd1306_set_display_on(SSD1306_DISPLAY_ON);
+	}
 
-	ssd1306_buffer_fill(White);
-	ssd1306_flush_dirty();
+	return ssd1306_bus_flush_complete();
+}
+
+/* Status of the last flush (ssd1306_flush_status) */
+static ssd1306_status_t ssd1306_flush_last;
+
+/*
+ * Account for the outcome of a flush. After a failure the GRAM content
+ * and the write pointer are unknown, so the next flush resends the whole
+ * frame; SSD1306_LINK_FAIL_LIMIT failures in a row hold flushes back.
+ */
+static void ssd1306_link_report(ssd1306_status_t rc) {
+	ssd1306_flush_last = rc;
+
+	if (rc == SSD1306_OK) {
+		ssd1306_state.link_failures = 0;
+		return;
+	}
+
+	ssd1306_state.resync = 1;
+	ssd1306_state.shadow_valid = 0;
+	ssd1306_state.gram_valid = 0;
+	ssd1306_state.gram_start_line = 0xFFu;
+
+	if (ssd1306_state.link_failures < 0xFFu) {
+		ssd1306_state.link_failures++;
+	}
+	if (ssd1306_state.link_failures >= SSD1306_LINK_FAIL_LIMIT) {
+		ssd1306_state.link_down = 1;
+		ssd1306_state.link_retry_ms = ssd1306_time_ticks_ms() + SSD1306_LINK_RETRY_MS;
+	}
+}
+
+/* An asynchronous transport reports failed transactions once it has
+ * gone idle; collect that without waiting */
+static void ssd1306_link_poll(void) {
+	ssd1306_status_t rc;
+
+	if (ssd1306_transport->busy == NULL || ssd1306_transport->wait_idle == NULL ||
+	    ssd1306_transport->busy(ssd1306_transport->ctx)) {
+		return;
+	}
+
+	rc = ssd1306_transport->wait_idle(ssd1306_transport->ctx);
+	if (rc != SSD1306_OK) {
+		ssd1306_link_report(rc);
+	}
+}
+
+/*
+ * SSD1306_OK when a flush may go out. While flushes are held back, one
+ * call per SSD1306_LINK_RETRY_MS probes the display: the transport
+ * recovers the bus, then the controller is set up again, and once that
+ * has gone through the next flush resends the whole frame.
+ */
+static ssd1306_status_t ssd1306_link_ready(void) {
+	ssd1306_status_t rc = SSD1306_OK;
+
+	ssd1306_link_poll();
+
+	if (!ssd1306_state.link_down) {
+		return SSD1306_OK;
+	}
+
+	if ((int32_t)(ssd1306_time_ticks_ms() - ssd1306_state.link_retry_ms) < 0) {
+		ssd1306_flush_last = SSD1306_OFFLINE;
+		return SSD1306_OFFLINE;
+	}
+
+	if (ssd1306_transport->recover) {
+		rc = ssd1306_transport->recover(ssd1306_transport->ctx);
+	}
+	if (rc == SSD1306_OK) {
+		rc = ssd1306_controller_setup();
+	}
+	if (rc == SSD1306_OK && ssd1306_transport->wait_idle) {
+		/* Queued setup commands have only been accepted, not sent */
+		rc = ssd1306_transport->wait_idle(ssd1306_transport->ctx);
+	}
+
+	if (rc != SSD1306_OK) {
+		ssd1306_flush_last = rc;
+		ssd1306_state.link_retry_ms = ssd1306_time_ticks_ms() + SSD1306_LINK_RETRY_MS;
+		return rc;
+	}
+
+	ssd1306_state.link_down = 0;
+	ssd1306_state.link_failures = 0;
+	ssd1306_state.resync = 1;
+
+	return SSD1306_OK;
+}
+
+/* After a failure: make the whole frame dirty again */
+static void ssd1306_resync_start(void) {
+	if (!ssd1306_state.resync) {
+		return;
+	}
+
+	ssd1306_state.resync = 0;
+	ssd1306_state.shadow_valid = 0;
+	ssd1306_state.flush_page = 0;
+	ssd1306_state.flush_column = 0;
+	ssd1306_dirty_mark_all();
+}
+
+/*
+ * End of a flush or flush step. A flush that went through with nothing
+ * left pending has sent every byte since the GRAM content was last
+ * unknown (a resync marks the whole frame), so the shadow is trusted
+ * from then on.
+ */
+static ssd1306_status_t ssd1306_flush_end(uint8_t pending) {
+	ssd1306_status_t rc = ssd1306_bus_flush_complete();
+
+	if (rc == SSD1306_OK && !pending) {
+		ssd1306_state.shadow_valid = 1;
+	}
+	ssd1306_link_report(rc);
+
+	return rc;
+}
+
+ssd1306_status_t ssd1306_init(void) {
+	return ssd1306_init_ex(&SSD1306_TRANSPORT_DEFAULT);
+}
+
+ssd1306_status_t ssd1306_init_ex(const ssd1306_transport_t *transport) {
+	ssd1306_status_t rc = SSD1306_OK;
+	ssd1306_status_t rc_flush;
+
+	ssd1306_transport = transport;
+	if (transport->init) {
+		rc = transport->init(transport->ctx);
+	}
+	SSD1306_DELAY_MS(100);
+
+	ssd1306_state.display_on = 1;
+	ssd1306_state.contrast = 0xFF;
+#ifdef SSD1306_INVERSE_COLOR
+	ssd1306_state.inverted = 1;
+#else
+	ssd1306_state.inverted = 0;
+#endif
+	ssd1306_state.resync = 0;
+	ssd1306_state.link_failures = 0;
+	ssd1306_state.link_down = 0;
+	ssd1306_state.start_line = 0;
+#ifdef SSD1306_DOUBLE_BUFFER
+	ssd1306_state.front_start_line = 0;
+#endif
 
+	if (rc == SSD1306_OK) {
+		rc = ssd1306_controller_setup();
+	}
+	ssd1306_link_report(rc);
+
+	/* Mark as initialized before the first flush, otherwise the flush
+	 * is skipped and GRAM keeps its power-on content.
+	 */
 	ssd1306_state.initialized = 1;
+
+#ifdef SSD1306_DOUBLE_BUFFER
+	memset(ssd1306_front_dirty_min, 0xFF, sizeof(ssd1306_front_dirty_min));
+	memset(ssd1306_front_dirty_max, 0x00, sizeof(ssd1306_front_dirty_max));
+	memset(ssd1306_front_dirty_flags, 0x00, sizeof(ssd1306_front_dirty_flags));
+#endif
+
+	ssd1306_clip_reset();
+	ssd1306_buffer_fill(White);
+	ssd1306_state.shadow_valid = 0;
+	ssd1306_state.flush_page = 0;
+	ssd1306_state.flush_column = 0;
+
+	/* Every byte is sent once: the shadow then matches the panel */
+	rc_flush = ssd1306_flush_dirty();
+
+	return (rc != SSD1306_OK) ? rc : rc_flush;
+}
+
+/* =======================================================================
+ * Clipping
+ * ======================================================================= */
+
+static SSD1306_Clip_t ssd1306_clip_stack[SSD1306_CLIP_STACK_DEPTH];
+static uint8_t ssd1306_clip_depth;
+
+uint8_t ssd1306_clip_push(int16_t x, int16_t y, int16_t w, int16_t h) {
+	if (ssd1306_clip_depth >= SSD1306_CLIP_STACK_DEPTH) {
+		return 0;
+	}
+
+	ssd1306_clip_stack[ssd1306_clip_depth++] = ssd1306_clip;
+
+	/* Intersect with the current rectangle; an empty result is kept as
+	 * is (x0 > x1 or y0 > y1), so every primitive rejects it up front.
+	 */
+	if (w <= 0 || h <= 0) {
+		ssd1306_clip.x1 = (int16_t)(ssd1306_clip.x0 - 1);
+		return 1;
+	}
+
+	ssd1306_clip.x0 = SSD1306_MAX(ssd1306_clip.x0, x);
+	ssd1306_clip.y0 = SSD1306_MAX(ssd1306_clip.y0, y);
+	ssd1306_clip.x1 = SSD1306_MIN(ssd1306_clip.x1, (int16_t)(x + w - 1));
+	ssd1306_clip.y1 = SSD1306_MIN(ssd1306_clip.y1, (int16_t)(y + h - 1));
+
+	return 1;
+}
+
+void ssd1306_clip_pop(void) {
+	if (ssd1306_clip_depth == 0u) {
+		return;
+	}
+
+	ssd1306_clip = ssd1306_clip_stack[--ssd1306_clip_depth];
+}
+
+void ssd1306_clip_reset(void) {
+	ssd1306_clip_depth = 0;
+	ssd1306_clip.x0 = 0;
+	ssd1306_clip.y0 = 0;
+	ssd1306_clip.x1 = SSD1306_WIDTH - 1;
+	ssd1306_clip.y1 = SSD1306_HEIGHT - 1;
 }
 
 /* =======================================================================
@@ -130,10 +364,12 @@ void ssd1306_buffer_draw_pixel(uint8_t x, uint8_t y, SSD1306_COLOR_t color) {
 	uint8_t is_new_value;
 	uint32_t dirty_index;
 
-	if (x >= SSD1306_WIDTH || y >= SSD1306_HEIGHT) {
+	if ((int16_t)x < ssd1306_clip.x0 || (int16_t)x > ssd1306_clip.x1 ||
+	    (int16_t)y < ssd1306_clip.y0 || (int16_t)y > ssd1306_clip.y1) {
 		return;
 	}
 
+	y = SSD1306_FB_ROW(y);
 	page = y / 8u;
 	buffer_index = x + page * SSD1306_WIDTH;
 	bit_mask = (uint8_t)(1u << (y % 8u));
@@ -145,6 +381,13 @@ void ssd1306_buffer_draw_pixel(uint8_t x, uint8_t y, SSD1306_COLOR_t color) {
 		dirty_index = page * SSD1306_WIDTH_BYTES + x / 8u;
 		ssd1306_dirty_flags[dirty_index] |= (uint8_t)(1u << (x % 8u));
 
+		if (x < ssd1306_dirty_min[page]) {
+			ssd1306_dirty_min[page] = x;
+		}
+		if (x > ssd1306_dirty_max[page]) {
+			ssd1306_dirty_max[page] = x;
+		}
+
 		if (color == White) {
 			ssd1306_buffer[buffer_index] |= bit_mask;
 		} else {
@@ -157,16 +400,85 @@ void ssd1306_buffer_draw_pixel(uint8_t x, uint8_t y, SSD1306_COLOR_t color) {
  * Text rendering
  * ======================================================================= */
 
+/* Largest block converted from scanlines to page-major in one pass
+ * (columns x pages); glyphs up to 16x32 fit in a single block.
+ */
+#define SSD1306_BLIT_BLOCK_COLS   16
+#define SSD1306_BLIT_BLOCK_PAGES  4
+
+/*
+ * Draw a row-major MSB-first 1bpp image: convert it to page-major column
+ * bytes 8x8 bits at a time, then blit each block with ssd1306_buffer_blit_pages.
+ * Blocks that are entirely outside the clip rectangle are skipped before
+ * conversion.
+ */
+static void ssd1306_buffer_blit_rows(int16_t x,
+				     int16_t y,
+				     const uint8_t *data,
+				     uint16_t bytes_per_row,
+				     int16_t width,
+				     int16_t height,
+				     SSD1306_COLOR_t color,
+				     SSD1306_ROP_t rop) {
+	uint8_t block[SSD1306_BLIT_BLOCK_PAGES * SSD1306_BLIT_BLOCK_COLS];
+	uint8_t rows[8];
+	uint8_t cols[8];
+	int16_t block_x, block_y;
+	int16_t block_w, block_h;
+	int16_t page, col, row, n;
+
+	for (block_y = 0; block_y < height; block_y = (int16_t)(block_y + block_h)) {
+		block_h = SSD1306_MIN((int16_t)(height - block_y), SSD1306_BLIT_BLOCK_PAGES * 8);
+
+		if (y + block_y + block_h <= ssd1306_clip.y0 || y + block_y > ssd1306_clip.y1) {
+			continue;
+		}
+
+		for (block_x = 0; block_x < width; block_x = (int16_t)(block_x + block_w)) {
+			block_w = SSD1306_MIN((int16_t)(width - block_x), SSD1306_BLIT_BLOCK_COLS);
+
+			if (x + block_x + block_w <= ssd1306_clip.x0 || x + block_x > ssd1306_clip.x1) {
+				continue;
+			}
+
+			for (page = 0; page * 8 < block_h; page++) {
+				for (col = 0; col < block_w; col = (int16_t)(col + 8)) {
+					for (row = 0; row < 8; row++) {
+						rows[row] = (page * 8 + row < block_h) ?
+							data[(uint32_t)(block_y + page * 8 + row) * bytes_per_row +
+							     (uint32_t)(block_x + col) / 8u] : 0x00u;
+					}
+					ssd1306_util_transpose8(rows, 1u, cols);
+
+					n = SSD1306_MIN((int16_t)(block_w - col), 8);
+					memcpy(&block[page * block_w + col], cols, (size_t)n);
+				}
+			}
+
+			ssd1306_buffer_blit_pages((int16_t)(x + block_x), (int16_t)(y + block_y),
+						  block, (uint8_t)block_w, (uint8_t)block_h, color, rop);
+		}
+	}
+}
+
 char ssd1306_buffer_draw_char_font(char ch,
 				   uint8_t x,
 				   uint8_t y,
 				   const SSD1306_Font_t *font,
 				   SSD1306_COLOR_t color) {
-	uint8_t row, col_byte, byte, bit, pixel_on;
+	return ssd1306_buffer_draw_char_font_ex(ch, x, y, font, color, SSD1306_ROP_COPY);
+}
+
+char ssd1306_buffer_draw_char_font_ex(char ch,
+				      uint8_t x,
+				      uint8_t y,
+				      const SSD1306_Font_t *font,
+				      SSD1306_COLOR_t color,
+				      SSD1306_ROP_t rop) {
 	uint8_t font_width;
 	uint8_t font_height;
 	uint8_t bytes_per_row;
-	uint32_t char_offset;
+	const uint8_t *glyph;
 
 	if (!font || !font->data) {
 		return 0;
@@ -177,29 +489,25 @@ char ssd1306_buffer_draw_char_font(char ch,
 
 	font_width = font->width;
 	font_height = font->height;
-	bytes_per_row = (uint8_t)((font_width + 7u) / 8u);
-	char_offset = (uint32_t)(ch - 32) * font_height * bytes_per_row;
 
-	if ((uint16_t)x + font_width > SSD1306_WIDTH ||
-	    (uint16_t)y + font_height > SSD1306_HEIGHT) {
+	/* Reject glyphs entirely outside the clip rectangle; partially
+	 * visible glyphs are clipped by the blitter.
+	 */
+	if ((int16_t)x > ssd1306_clip.x1 || (int16_t)(x + font_width) <= ssd1306_clip.x0 ||
+	    (int16_t)y > ssd1306_clip.y1 || (int16_t)(y + font_height) <= ssd1306_clip.y0) {
 		return 0;
 	}
 
-	for (row = 0; row < font_height; row++) {
-		for (col_byte = 0; col_byte < bytes_per_row; col_byte++) {
-			byte = font->data[char_offset + (uint32_t)row * bytes_per_row + col_byte];
-
-			for (bit = 0; bit < 8u; bit++) {
-				pixel_on = (uint8_t)((byte >> (7u - bit)) & 0x01u);
-
-				/* Non-transparent glyph: background is inverse of text color */
-				ssd1306_buffer_draw_pixel(
-					(uint8_t)(x + (uint8_t)(col_byte * 8u) + bit),
-					(uint8_t)(y + row),
-					pixel_on ? color : (SSD1306_COLOR_t)!color
-				);
-			}
-		}
+	/* Page-major fonts are already in GRAM order and are blitted as is;
+	 * row-major fonts are transposed block by block.
+	 */
+	if (font->layout == SSD1306_FONT_LAYOUT_PAGE_MAJOR) {
+		glyph = &font->data[(uint32_t)(ch - 32) * font_width * ((font_height + 7u) / 8u)];
+		ssd1306_buffer_blit_pages(x, y, glyph, font_width, font_height, color, rop);
+	} else {
+		bytes_per_row = (uint8_t)((font_width + 7u) / 8u);
+		glyph = &font->data[(uint32_t)(ch - 32) * font_height * bytes_per_row];
+		ssd1306_buffer_blit_rows(x, y, glyph, bytes_per_row, font_width, font_height, color, rop);
 	}
 
 	return ch;
@@ -217,7 +525,17 @@ void ssd1306_buffer_draw_string_font(const char *str,
 				     uint8_t y,
 				     const SSD1306_Font_t *font,
 				     SSD1306_COLOR_t color) {
+	ssd1306_buffer_draw_string_font_ex(str, x, y, font, color, SSD1306_ROP_COPY);
+}
+
+void ssd1306_buffer_draw_string_font_ex(const char *str,
+					uint8_t x,
+					uint8_t y,
+					const SSD1306_Font_t *font,
+					SSD1306_COLOR_t color,
+					SSD1306_ROP_t rop) {
 	uint16_t codepoint;
+	uint16_t pen_x;
 	uint8_t ch;
 	const char *ptr;
 	const char *next;
@@ -226,9 +544,16 @@ void ssd1306_buffer_draw_string_font(const char *str,
 		return;
 	}
 
+	/* Text entirely above or below the clip rectangle */
+	if ((int16_t)y > ssd1306_clip.y1 || (int16_t)(y + font->height) <= ssd1306_clip.y0) {
+		return;
+	}
+
 	ptr = str;
+	pen_x = x;
 
-	for (;;) {
+	/* Stop at the right edge of the clip rectangle */
+	while ((int16_t)pen_x <= ssd1306_clip.x1) {
 		next = ssd1306_next_char(ptr, &codepoint);
 		if (next == (const char *)0) {
 			break;
@@ -236,8 +561,8 @@ void ssd1306_buffer_draw_string_font(const char *str,
 
 		ptr = next;
 		ch = ssd1306_map_char_unicode(codepoint);
-		ssd1306_buffer_draw_char_font((char)ch, x, y, font, color);
-		x = (uint8_t)(x + font->width);
+		ssd1306_buffer_draw_char_font_ex((char)ch, (uint8_t)pen_x, y, font, color, rop);
+		pen_x = (uint16_t)(pen_x + font->width);
 	}
 }
 
@@ -250,7 +575,11 @@ void ssd1306_buffer_draw_string(const char *str,
 
 void ssd1306_buffer_fill(SSD1306_COLOR_t color) {
 	memset(ssd1306_buffer, (color == Black) ? 0x00 : 0xFF, sizeof(ssd1306_buffer));
-	memset(ssd1306_dirty_flags, 0xFF, sizeof(ssd1306_dirty_flags));
+	ssd1306_dirty_mark_all();
+#ifdef SSD1306_UI_MENU_START_LINE
+	/* Menus on screen (ssd1306_display_clear() too) are wiped */
+	ssd1306_state.fill_count++;
+#endif
 }
 
 void ssd1306_display_clear(void) {
@@ -272,78 +601,86 @@ void ssd1306_buffer_draw_line(int16_t x0,
 			      int16_t x1,
 			      int16_t y1,
 			      SSD1306_COLOR_t color) {
-	/* Cohen–Sutherland clipping, then Bresenham line drawing */
-	uint8_t out0, out1, outcode_out;
+	/* Bresenham on the original endpoints, entered where the line
+	 * reaches the clip rectangle: the pixels inside it are the same as
+	 * for the unclipped line, so a line split over clip regions has no
+	 * seams. Along the major axis, minor step m after k major steps is
+	 * m = (2 * minor * k + major) / (2 * major), kept incrementally with
+	 * its remainder.
+	 */
+	int32_t adx, ady;
+	int32_t major, minor;
+	int32_t k, k_last;
+	int32_t m, rem;
+	int16_t sx, sy;
 	int16_t x, y;
-	int16_t dx, dy, sx, sy, err, e2;
-	bool accept;
-
-	out0 = ssd1306_geom_compute_out_code(x0, y0);
-	out1 = ssd1306_geom_compute_out_code(x1, y1);
-	accept = false;
-
-	while (1) {
-		if (!(out0 | out1)) {
-			/* both endpoints inside */
-			accept = true;
-			break;
-		} else if (out0 & out1) {
-			/* both endpoints in the same outside region -> invisible */
-			return;
-		} else {
-			outcode_out = out0 ? out0 : out1;
-
-			if (outcode_out & SSD1306_CS_TOP) {
-				x = x0 + (x1 - x0) * (0 - y0) / (y1 - y0);
-				y = 0;
-			} else if (outcode_out & SSD1306_CS_BOTTOM) {
-				x = x0 + (x1 - x0) * (SSD1306_HEIGHT - 1 - y0) / (y1 - y0);
-				y = SSD1306_HEIGHT - 1;
-			} else if (outcode_out & SSD1306_CS_RIGHT) {
-				y = y0 + (y1 - y0) * (SSD1306_WIDTH - 1 - x0) / (x1 - x0);
-				x = SSD1306_WIDTH - 1;
-			} else {
-				/* LEFT */
-				y = y0 + (y1 - y0) * (0 - x0) / (x1 - x0);
-				x = 0;
-			}
+	uint8_t x_major;
 
-			if (outcode_out == out0) {
-				x0 = x;
-				y0 = y;
-				out0 = ssd1306_geom_compute_out_code(x0, y0);
-			} else {
-				x1 = x;
-				y1 = y;
-				out1 = ssd1306_geom_compute_out_code(x1, y1);
-			}
-		}
+	/* Axis-aligned lines: a horizontal line is a single-bit span on one page,
+	 * a vertical line is one masked byte per page; both are clipped and
+	 * written by the span filler.
+	 */
+	if (y0 == y1 || x0 == x1) {
+		ssd1306_buffer_fill_rect_xy(x0, y0, x1, y1, color);
+		return;
 	}
 
-	if (!accept) {
+	/* Both endpoints in the same outside region: invisible */
+	if (ssd1306_geom_compute_out_code(x0, y0) & ssd1306_geom_compute_out_code(x1, y1)) {
 		return;
 	}
 
-	/* Bresenham */
-	dx = (int16_t)abs(x1 - x0);
-	dy = (int16_t)-abs(y1 - y0);
+	adx = abs(x1 - x0);
+	ady = abs(y1 - y0);
 	sx = (x0 < x1) ? 1 : -1;
 	sy = (y0 < y1) ? 1 : -1;
-	err = dx + dy;
+	x_major = (adx >= ady) ? 1u : 0u;
+
+	/* Major-axis steps that land inside the clip rectangle's span */
+	if (x_major) {
+		major = adx;
+		minor = ady;
+		k = (sx > 0) ? ssd1306_clip.x0 - x0 : x0 - ssd1306_clip.x1;
+		k_last = (sx > 0) ? ssd1306_clip.x1 - x0 : x0 - ssd1306_clip.x0;
+	} else {
+		major = ady;
+		minor = adx;
+		k = (sy > 0) ? ssd1306_clip.y0 - y0 : y0 - ssd1306_clip.y1;
+		k_last = (sy > 0) ? ssd1306_clip.y1 - y0 : y0 - ssd1306_clip.y0;
+	}
+	k = SSD1306_MAX(k, 0);
+	k_last = SSD1306_MIN(k_last, major);
 
-	while (1) {
-		ssd1306_buffer_draw_pixel((uint8_t)x0, (uint8_t)y0, color);
-		if (x0 == x1 && y0 == y1) {
-			break;
+	if (k > k_last) {
+		return;
+	}
+
+	/* 64-bit once: coordinates span up to 16 bits each */
+	m = (int32_t)(((int64_t)2 * minor * k + major) / (2 * major));
+	rem = (int32_t)(((int64_t)2 * minor * k + major) % (2 * major));
+
+	for (; k <= k_last; k++) {
+		if (x_major) {
+			x = (int16_t)(x0 + sx * k);
+			y = (int16_t)(y0 + sy * m);
+		} else {
+			x = (int16_t)(x0 + sx * m);
+			y = (int16_t)(y0 + sy * k);
 		}
-		e2 = (int16_t)(2 * err);
-		if (e2 >= dy) {
-			err = (int16_t)(err + dy);
-			x0 = (int16_t)(x0 + sx);
+
+		if (x >= ssd1306_clip.x0 && x <= ssd1306_clip.x1 &&
+		    y >= ssd1306_clip.y0 && y <= ssd1306_clip.y1) {
+			ssd1306_buffer_draw_pixel((uint8_t)x, (uint8_t)y, color);
+		} else if (x_major ? (sy > 0 ? y > ssd1306_clip.y1 : y < ssd1306_clip.y0)
+		                   : (sx > 0 ? x > ssd1306_clip.x1 : x < ssd1306_clip.x0)) {
+			/* Left the clip rectangle along the minor axis for good */
+			return;
 		}
-		if (e2 <= dx) {
-			err = (int16_t)(err + dx);
-			y0 = (int16_t)(y0 + sy);
+
+		rem += 2 * minor;
+		if (rem >= 2 * major) {
+			rem -= 2 * major;
+			m++;
 		}
 	}
 }
@@ -390,7 +727,9 @@ void ssd1306_buffer_fill_rect_xy(int16_t x0,
 				 int16_t x1,
 				 int16_t y1,
 				 SSD1306_COLOR_t color) {
-	int16_t x, y, t;
+	int16_t t;
+	uint8_t page, page_first, page_last;
+	uint8_t mask;
 
 	if (x0 > x1) {
 		t = x0; x0 = x1; x1 = t;
@@ -399,16 +738,29 @@ void ssd1306_buffer_fill_rect_xy(int16_t x0,
 		t = y0; y0 = y1; y1 = t;
 	}
 
-	for (y = y0; y <= y1; y++) {
-		if (y < 0 || y >= (int16_t)SSD1306_HEIGHT) {
-			continue;
+	/* clip to the clip rectangle */
+	x0 = SSD1306_MAX(x0, ssd1306_clip.x0);
+	y0 = SSD1306_MAX(y0, ssd1306_clip.y0);
+	x1 = SSD1306_MIN(x1, ssd1306_clip.x1);
+	y1 = SSD1306_MIN(y1, ssd1306_clip.y1);
+
+	if (x0 > x1 || y0 > y1) {
+		return;
+	}
+
+	/* one masked span per page: partial masks only on the first/last page */
+	page_first = (uint8_t)(y0 / 8);
+	page_last = (uint8_t)(y1 / 8);
+
+	for (page = page_first; page <= page_last; page++) {
+		mask = 0xFFu;
+		if (page == page_first) {
+			mask &= (uint8_t)(0xFFu << (y0 % 8));
 		}
-		for (x = x0; x <= x1; x++) {
-			if (x < 0 || x >= (int16_t)SSD1306_WIDTH) {
-				continue;
-			}
-			ssd1306_buffer_draw_pixel((uint8_t)x, (uint8_t)y, color);
+		if (page == page_last) {
+			mask &= (uint8_t)(0xFFu >> (7 - (y1 % 8)));
 		}
+		ssd1306_buffer_write_span(page, (uint8_t)x0, (uint8_t)x1, mask, color);
 	}
 }
 
@@ -436,6 +788,12 @@ void ssd1306_buffer_draw_circle(int16_t xc,
 	int16_t y = r;
 	int16_t d = (int16_t)(3 - 2 * r);
 
+	/* Bounding box entirely outside the clip rectangle */
+	if (xc + r < ssd1306_clip.x0 || xc - r > ssd1306_clip.x1 ||
+	    yc + r < ssd1306_clip.y0 || yc - r > ssd1306_clip.y1) {
+		return;
+	}
+
 	while (y >= x) {
 		ssd1306_buffer_draw_pixel((uint8_t)(xc + x), (uint8_t)(yc + y), color);
 		ssd1306_buffer_draw_pixel((uint8_t)(xc - x), (uint8_t)(yc + y), color);
@@ -456,6 +814,20 @@ void ssd1306_buffer_draw_circle(int16_t xc,
 	}
 }
 
+/* Fill rows yc - dy and yc + dy from xc - hw to xc + hw (one row if dy == 0) */
+static void ssd1306_buffer_fill_circle_rows(int16_t xc,
+					    int16_t yc,
+					    int16_t dy,
+					    int16_t hw,
+					    SSD1306_COLOR_t color) {
+	ssd1306_buffer_fill_rect_xy((int16_t)(xc - hw), (int16_t)(yc - dy),
+				    (int16_t)(xc + hw), (int16_t)(yc - dy), color);
+	if (dy != 0) {
+		ssd1306_buffer_fill_rect_xy((int16_t)(xc - hw), (int16_t)(yc + dy),
+					    (int16_t)(xc + hw), (int16_t)(yc + dy), color);
+	}
+}
+
 void ssd1306_buffer_fill_circle(int16_t xc,
 				int16_t yc,
 				int16_t r,
@@ -463,26 +835,36 @@ void ssd1306_buffer_fill_circle(int16_t xc,
 	int16_t x = 0;
 	int16_t y = r;
 	int16_t d = (int16_t)(3 - 2 * r);
-	int16_t i;
 
+	if (r < 0) {
+		return;
+	}
+
+	/* Bounding box entirely outside the clip rectangle */
+	if (xc + r < ssd1306_clip.x0 || xc - r > ssd1306_clip.x1 ||
+	    yc + r < ssd1306_clip.y0 || yc - r > ssd1306_clip.y1) {
+		return;
+	}
+
+	/* Midpoint walk over one octant. Row offset x gets half-width y as
+	 * soon as it is reached (x grows every step). Row offset y gets its
+	 * final half-width x only when y is about to decrease, and is skipped
+	 * when it coincides with the x row just drawn. Every scanline is
+	 * therefore filled exactly once, each as a byte-masked span.
+	 */
 	while (y >= x) {
-		/* horizontal spans between circle points */
-		for (i = (int16_t)(xc - x); i <= (int16_t)(xc + x); i++) {
-			ssd1306_buffer_draw_pixel((uint8_t)i, (uint8_t)(yc + y), color);
-			ssd1306_buffer_draw_pixel((uint8_t)i, (uint8_t)(yc - y), color);
-		}
-		for (i = (int16_t)(xc - y); i <= (int16_t)(xc + y); i++) {
-			ssd1306_buffer_draw_pixel((uint8_t)i, (uint8_t)(yc + x), color);
-			ssd1306_buffer_draw_pixel((uint8_t)i, (uint8_t)(yc - x), color);
-		}
+		ssd1306_buffer_fill_circle_rows(xc, yc, x, y, color);
 
-		x++;
 		if (d > 0) {
+			if (y != x) {
+				ssd1306_buffer_fill_circle_rows(xc, yc, y, x, color);
+			}
 			y--;
-			d = (int16_t)(d + 4 * (x - y) + 10);
+			d = (int16_t)(d + 4 * (x + 1 - y) + 10);
 		} else {
-			d = (int16_t)(d + 4 * x + 6);
+			d = (int16_t)(d + 4 * (x + 1) + 6);
 		}
+		x++;
 	}
 }
 
@@ -492,35 +874,47 @@ void ssd1306_buffer_draw_bitmap(int16_t x,
 				int16_t width,
 				int16_t height,
 				SSD1306_COLOR_t color) {
-	int16_t i, j;
-	uint8_t byte, bit;
-	SSD1306_COLOR_t px_color;
-	SSD1306_COLOR_t bg_color;
-	int bytes_per_row;
+	ssd1306_buffer_draw_bitmap_ex(x, y, image, width, height, color, SSD1306_ROP_COPY);
+}
 
+void ssd1306_buffer_draw_bitmap_ex(int16_t x,
+				   int16_t y,
+				   const uint8_t *image,
+				   int16_t width,
+				   int16_t height,
+				   SSD1306_COLOR_t color,
+				   SSD1306_ROP_t rop) {
 	if (!image || width <= 0 || height <= 0) {
 		return;
 	}
 
-	bg_color = (color == White) ? Black : White;
+	/* Scanlines are MSB-first, (width + 7) / 8 bytes each */
+	ssd1306_buffer_blit_rows(x, y, image, (uint16_t)((width + 7) / 8),
+				 width, height, color, rop);
+}
 
-	/* Number of bytes per scanline (MSB-first, width up to panel width) */
-	bytes_per_row = (int)((width + 7) / 8);
+void ssd1306_buffer_draw_bitmap_pages(int16_t x,
+				      int16_t y,
+				      const uint8_t *image,
+				      int16_t width,
+				      int16_t height,
+				      SSD1306_COLOR_t color) {
+	ssd1306_buffer_draw_bitmap_pages_ex(x, y, image, width, height, color, SSD1306_ROP_COPY);
+}
 
-	for (j = 0; j < height; j++) {
-		if (y + j < 0 || y + j >= (int16_t)SSD1306_HEIGHT) {
-			continue;
-		}
-		for (i = 0; i < width; i++) {
-			if (x + i < 0 || x + i >= (int16_t)SSD1306_WIDTH) {
-				continue;
-			}
-			byte = image[j * bytes_per_row + (i / 8)];
-			bit = (uint8_t)(7 - (i % 8));
-			px_color = (byte & (uint8_t)(1u << bit)) ? color : bg_color;
-			ssd1306_buffer_draw_pixel((uint8_t)(x + i), (uint8_t)(y + j), px_color);
-		}
+void ssd1306_buffer_draw_bitmap_pages_ex(int16_t x,
+					 int16_t y,
+					 const uint8_t *image,
+					 int16_t width,
+					 int16_t height,
+					 SSD1306_COLOR_t color,
+					 SSD1306_ROP_t rop) {
+	if (!image || width <= 0 || height <= 0 ||
+	    width > SSD1306_WIDTH || height > SSD1306_HEIGHT) {
+		return;
 	}
+
+	ssd1306_buffer_blit_pages(x, y, image, (uint8_t)width, (uint8_t)height, color, rop);
 }
 
 void ssd1306_buffer_draw_triangle(int x0,
@@ -535,6 +929,90 @@ void ssd1306_buffer_draw_triangle(int x0,
 	ssd1306_buffer_draw_line((int16_t)x2, (int16_t)y2, (int16_t)x0, (int16_t)y0, color);
 }
 
+/*
+ * Integer edge walker for the triangle fill. The edge x coordinate at the
+ * current scanline is kept as q + r / dy (0 <= r < dy) and advanced by a
+ * constant quotient/remainder step per row, so no division or float is
+ * needed inside the scanline loop.
+ */
+typedef struct {
+	int32_t q;       /* integer part of x */
+	int32_t r;       /* remainder, 0 <= r < dy */
+	int32_t dy;      /* edge height (> 0) */
+	int32_t step_q;  /* floor(dx / dy) */
+	int32_t step_r;  /* dx - step_q * dy */
+} ssd1306_edge_t;
+
+/* Floor division for a positive divisor */
+static int32_t ssd1306_floor_div(int32_t num, int32_t den) {
+	int32_t q = num / den;
+
+	if ((num % den) != 0 && num < 0) {
+		q--;
+	}
+	return q;
+}
+
+/* Set up edge (xa, ya) -> (xb, yb), ya < yb, positioned at scanline 'y' */
+static void ssd1306_edge_init(ssd1306_edge_t *e,
+			      int32_t xa, int32_t ya,
+			      int32_t xb, int32_t yb,
+			      int32_t y) {
+	int32_t dx = xb - xa;
+	int32_t num;
+	int32_t whole;
+
+	e->dy = yb - ya;
+	e->step_q = ssd1306_floor_div(dx, e->dy);
+	e->step_r = dx - e->step_q * e->dy;
+
+	num = dx * (y - ya);
+	whole = ssd1306_floor_div(num, e->dy);
+	e->q = xa + whole;
+	e->r = num - whole * e->dy;
+}
+
+static void ssd1306_edge_step(ssd1306_edge_t *e) {
+	e->q += e->step_q;
+	e->r += e->step_r;
+	if (e->r >= e->dy) {
+		e->r -= e->dy;
+		e->q++;
+	}
+}
+
+/* Smallest integer >= current edge x */
+static int32_t ssd1306_edge_ceil(const ssd1306_edge_t *e) {
+	return e->q + ((e->r != 0) ? 1 : 0);
+}
+
+/*
+ * Fill scanlines y_first..y_last (inclusive) between two edges: pixel x is
+ * drawn when ceil(left) <= x < ceil(right), i.e. samples exactly on a left
+ * edge are inside and samples on a right edge are outside.
+ */
+static void ssd1306_fill_between_edges(ssd1306_edge_t *left,
+				       ssd1306_edge_t *right,
+				       int32_t y_first,
+				       int32_t y_last,
+				       SSD1306_COLOR_t color) {
+	int32_t y;
+	int32_t xl, xr;
+
+	for (y = y_first; y <= y_last; y++) {
+		xl = SSD1306_MAX(ssd1306_edge_ceil(left), (int32_t)ssd1306_clip.x0);
+		xr = SSD1306_MIN(ssd1306_edge_ceil(right) - 1, (int32_t)ssd1306_clip.x1);
+
+		if (xl <= xr) {
+			ssd1306_buffer_fill_rect_xy((int16_t)xl, (int16_t)y,
+						    (int16_t)xr, (int16_t)y, color);
+		}
+
+		ssd1306_edge_step(left);
+		ssd1306_edge_step(right);
+	}
+}
+
 void ssd1306_buffer_fill_triangle(int x0,
 				  int y0,
 				  int x1,
@@ -542,40 +1020,228 @@ void ssd1306_buffer_fill_triangle(int x0,
 				  int x2,
 				  int y2,
 				  SSD1306_COLOR_t color) {
-	int total_height;
-	int i;
-	int segment_height;
-	int ax, bx;
-	bool second_half;
-	float alpha, beta;
+	ssd1306_edge_t long_edge, short_edge;
+	int32_t cross;
+	int32_t y_first, y_last;
+	int32_t seg_first, seg_last;
+	bool long_is_left;
 
 	/* sort vertices so that y0 <= y1 <= y2 */
 	if (y0 > y1) { ssd1306_util_swap_int(&y0, &y1); ssd1306_util_swap_int(&x0, &x1); }
 	if (y1 > y2) { ssd1306_util_swap_int(&y1, &y2); ssd1306_util_swap_int(&x1, &x2); }
 	if (y0 > y1) { ssd1306_util_swap_int(&y0, &y1); ssd1306_util_swap_int(&x0, &x1); }
 
-	total_height = y2 - y0;
+	/* Vertices are pixel centers. Scanlines y0..y2-1 are sampled (top-left
+	 * rule: a flat top edge is inside, a flat bottom edge is outside), and
+	 * only the rows inside the clip rectangle are walked.
+	 */
+	y_first = SSD1306_MAX((int32_t)y0, (int32_t)ssd1306_clip.y0);
+	y_last = SSD1306_MIN((int32_t)y2 - 1, (int32_t)ssd1306_clip.y1);
 
-	for (i = 0; i < total_height; i++) {
-		second_half = (bool)(i > y1 - y0 || y1 == y0);
-		segment_height = second_half ? (y2 - y1) : (y1 - y0);
-		if (segment_height == 0) {
-			continue;
+	if (y_first > y_last) {
+		return;
+	}
+	if (SSD1306_MAX(SSD1306_MAX(x0, x1), x2) < ssd1306_clip.x0 ||
+	    SSD1306_MIN(SSD1306_MIN(x0, x1), x2) > ssd1306_clip.x1) {
+		return;
+	}
+
+	/* Orientation: the long edge v0->v2 is on the left when v1 lies to
+	 * its right. Degenerate (zero area) triangles cover no samples.
+	 */
+	cross = (int32_t)(x2 - x0) * (y1 - y0) - (int32_t)(x1 - x0) * (y2 - y0);
+	if (cross == 0) {
+		return;
+	}
+	long_is_left = (bool)(cross < 0);
+
+	ssd1306_edge_init(&long_edge, x0, y0, x2, y2, y_first);
+
+	/* Upper part: rows y0..y1-1 between v0->v2 and v0->v1 */
+	seg_first = y_first;
+	seg_last = SSD1306_MIN((int32_t)y1 - 1, y_last);
+	if (seg_first <= seg_last) {
+		ssd1306_edge_init(&short_edge, x0, y0, x1, y1, seg_first);
+		if (long_is_left) {
+			ssd1306_fill_between_edges(&long_edge, &short_edge, seg_first, seg_last, color);
+		} else {
+			ssd1306_fill_between_edges(&short_edge, &long_edge, seg_first, seg_last, color);
 		}
+	}
+
+	/* Lower part: rows y1..y2-1 between v0->v2 and v1->v2 */
+	seg_first = SSD1306_MAX((int32_t)y1, y_first);
+	seg_last = y_last;
+	if (seg_first <= seg_last) {
+		ssd1306_edge_init(&long_edge, x0, y0, x2, y2, seg_first);
+		ssd1306_edge_init(&short_edge, x1, y1, x2, y2, seg_first);
+		if (long_is_left) {
+			ssd1306_fill_between_edges(&long_edge, &short_edge, seg_first, seg_last, color);
+		} else {
+			ssd1306_fill_between_edges(&short_edge, &long_edge, seg_first, seg_last, color);
+		}
+	}
+}
 
-		alpha = (float)i / (float)total_height;
-		beta = (float)(i - (second_half ? (y1 - y0) : 0)) / (float)segment_height;
+/* =======================================================================
+ * Hardware scrolling
+ * ======================================================================= */
 
-		ax = x0 + (int)((x2 - x0) * alpha);
-		bx = second_half ?
-			(x1 + (int)((x2 - x1) * beta)) :
-			(x0 + (int)((x1 - x0) * beta));
+/* The scroll commands name directions in SEG order; with the segment
+ * remap (SSD1306_MIRROR_HORIZ) that is also the visible one */
+#ifdef SSD1306_MIRROR_HORIZ
+#define SSD1306_SCROLL_CMD(dir, right, left) (((dir) == SSD1306_SCROLL_LEFT) ? (left) : (right))
+#else
+#define SSD1306_SCROLL_CMD(dir, right, left) (((dir) == SSD1306_SCROLL_LEFT) ? (right) : (left))
+#endif
+
+ssd1306_status_t ssd1306_scroll_start(uint8_t page0, uint8_t page1, uint8_t dir, uint8_t interval) {
+	return ssd1306_scroll_start_ex(page0, page1, dir, interval, 0);
+}
+
+ssd1306_status_t ssd1306_scroll_start_ex(uint8_t page0,
+                                         uint8_t page1,
+                                         uint8_t dir,
+                                         uint8_t interval,
+                                         uint8_t vertical) {
+	uint8_t cmds[10];
+	uint8_t n = 0;
+	ssd1306_status_t rc;
+
+	if (!ssd1306_state.initialized || page0 > page1 || page1 >= SSD1306_PAGES ||
+	    vertical >= SSD1306_GRAM_PAGES * 8U) {
+		return SSD1306_ERR;
+	}
+
+	/* The controller takes a new setup only with scrolling off */
+	ssd1306_scroll_stop();
+
+	/* What scrolls is what the framebuffer holds now */
+	rc = ssd1306_flush_dirty();
+	if (rc != SSD1306_OK) {
+		return rc;
+	}
+
+	if (vertical != 0U) {
+		/* Whole display in the vertical scroll area */
+		cmds[n++] = SSD1306_CMD_SET_VERTICAL_SCROLL_AREA;
+		cmds[n++] = 0x00;
+		cmds[n++] = SSD1306_GRAM_PAGES * 8U;
+		cmds[n++] = SSD1306_SCROLL_CMD(dir, SSD1306_CMD_SCROLL_VERTICAL_RIGHT,
+		                               SSD1306_CMD_SCROLL_VERTICAL_LEFT);
+	} else {
+		cmds[n++] = SSD1306_SCROLL_CMD(dir, SSD1306_CMD_SCROLL_RIGHT, SSD1306_CMD_SCROLL_LEFT);
+	}
+	cmds[n++] = 0x00;
+	cmds[n++] = (uint8_t)(page0 + SSD1306_PAGE_OFFSET);
+	cmds[n++] = (uint8_t)(interval & 0x07U);
+	cmds[n++] = (uint8_t)(page1 + SSD1306_PAGE_OFFSET);
+	if (vertical != 0U) {
+		cmds[n++] = vertical;
+	} else {
+		cmds[n++] = 0x00;
+		cmds[n++] = 0xFF;
+	}
+	cmds[n++] = SSD1306_CMD_SCROLL_ACTIVATE;
+
+	ssd1306_bus_flush_begin();
+	ssd1306_write_commands(cmds, n);
+	rc = ssd1306_bus_flush_complete();
+	if (rc != SSD1306_OK) {
+		ssd1306_link_report(rc);
+		return rc;
+	}
+
+	ssd1306_state.scroll_active = 1;
+	ssd1306_state.scroll_page0 = page0;
+	ssd1306_state.scroll_page1 = page1;
+	ssd1306_state.scroll_vertical = vertical;
+
+	return SSD1306_OK;
+}
+
+void ssd1306_scroll_stop(void) {
+	uint8_t page;
+
+	if (!ssd1306_state.scroll_active) {
+		return;
+	}
+
+	ssd1306_write_command(SSD1306_CMD_SCROLL_DEACTIVATE);
+	if (ssd1306_state.scroll_vertical != 0U) {
+		/* Vertical scrolling moved the start line: the next flush sets
+		 * it again */
+		ssd1306_state.gram_start_line = 0xFFu;
+	}
+	ssd1306_state.scroll_active = 0;
+
+	/* The scrolled pages were rotated in GRAM by however far they moved:
+	 * whatever the shadow says, the framebuffer has to be sent again */
+	for (page = ssd1306_state.scroll_page0; page <= ssd1306_state.scroll_page1; page++) {
+		ssd1306_dirty_mark_range(page, 0, SSD1306_WIDTH - 1U);
+	}
+	ssd1306_state.shadow_valid = 0;
+}
+
+uint8_t ssd1306_scroll_active(void) {
+	return ssd1306_state.scroll_active;
+}
+
+ssd1306_status_t ssd1306_buffer_scroll_rows(int8_t rows) {
+#if (SSD1306_HEIGHT == SSD1306_GRAM_PAGES * 8)
+	/* Display row y moves to y - rows: it is framebuffer row
+	 * y + start_line, so the start line advances by 'rows' */
+	ssd1306_state.start_line = (uint8_t)(((int16_t)ssd1306_state.start_line + rows % SSD1306_HEIGHT +
+	                                      SSD1306_HEIGHT) % SSD1306_HEIGHT);
+	return SSD1306_OK;
+#else
+	/* The start line wraps at the multiplex ratio, not at the panel */
+	(void)rows;
+	return SSD1306_ERR;
+#endif
+}
 
-		if (ax > bx) {
-			ssd1306_util_swap_int(&ax, &bx);
+/* Program the start line the frame being sent was drawn with */
+static void ssd1306_start_line_sync(void) {
+	if (ssd1306_state.gram_start_line != SSD1306_TX_START_LINE) {
+		ssd1306_write_command((uint8_t)(SSD1306_CMD_SET_START_LINE | SSD1306_TX_START_LINE));
+		ssd1306_state.gram_start_line = SSD1306_TX_START_LINE;
+	}
+}
+
+/* Non-zero for a page the controller is scrolling */
+static uint8_t ssd1306_scroll_holds(uint8_t page) {
+	return (uint8_t)(ssd1306_state.scroll_active &&
+	                 page >= ssd1306_state.scroll_page0 && page <= ssd1306_state.scroll_page1);
+}
+
+/*
+ * Hide the transmit-side extents of scrolling pages from a flush, so
+ * nothing is written where the controller moves the content; what was
+ * drawn there waits in the dirty set for ssd1306_scroll_stop().
+ * ssd1306_scroll_release() puts the extents back.
+ */
+static void ssd1306_scroll_hold(uint8_t *saved_min, uint8_t *saved_max) {
+	uint8_t page;
+
+	for (page = 0; page < SSD1306_PAGES; page++) {
+		if (ssd1306_scroll_holds(page)) {
+			saved_min[page] = SSD1306_TX_DIRTY_MIN[page];
+			saved_max[page] = SSD1306_TX_DIRTY_MAX[page];
+			SSD1306_TX_DIRTY_MIN[page] = 0xFFu;
+			SSD1306_TX_DIRTY_MAX[page] = 0x00u;
+		}
+	}
+}
+
+static void ssd1306_scroll_release(const uint8_t *saved_min, const uint8_t *saved_max) {
+	uint8_t page;
+
+	for (page = 0; page < SSD1306_PAGES; page++) {
+		if (ssd1306_scroll_holds(page)) {
+			SSD1306_TX_DIRTY_MIN[page] = saved_min[page];
+			SSD1306_TX_DIRTY_MAX[page] = saved_max[page];
 		}
-		ssd1306_buffer_draw_line((int16_t)ax, (int16_t)(y0 + i),
-					 (int16_t)bx, (int16_t)(y0 + i), color);
 	}
 }
 
@@ -583,100 +1249,487 @@ void ssd1306_buffer_fill_triangle(int x0,
  * Dirty-region flush
  * ======================================================================= */
 
-void ssd1306_flush_dirty(void) {
-	/* Each bit in ssd1306_dirty_flags marks one vertical byte (8 pixels).
-	 * We walk over all bits, compressing consecutive dirty bytes on the same
-	 * page into blocks (batch_start + batch_len), then send those blocks.
-	 */
-	uint32_t bit_index = 0;				/* current bit index (0..WIDTH*HEIGHT/8), each bit = 1 vertical byte */
-	uint32_t batch_start = 0;			/* start x (in pixels) of current dirty block */
-	uint32_t batch_len = 0;				/* length of current block in bytes */
-	uint32_t dirty_square_index = 0;	/* index in dirty_flags (each entry = 8x8 block) */
-	uint8_t dirty_byte = 0;				/* each bit marks a dirty vertical byte */
-	uint8_t last_byte_dirty = 0;		/* previous byte in block was dirty */
-	uint8_t batch_found = 0;			/* a block to send is ready */
-	uint8_t page = 0;					/* current display page */
-	uint8_t i;
+/* Bus byte-times of streaming 'area' bytes through a window, at 'tx_cost'
+ * per transaction */
+static uint32_t ssd1306_window_cost(uint32_t area, uint32_t tx_cost) {
+	return area + (area + SSD1306_DATA_TX_MAX - 1U) / SSD1306_DATA_TX_MAX * tx_cost;
+}
 
-	if (!ssd1306_state.initialized) {
-		return;
+/*
+ * Decide between per-page runs and one windowed stream (see
+ * ssd1306_send_window) from the dirty extents. Returns 1 and the window
+ * when the bounding rectangle of all dirty pages, or the whole frame,
+ * is estimated cheaper on the bus than addressing every page.
+ */
+static uint8_t ssd1306_flush_plan_window(uint8_t *page0,
+                                         uint8_t *page1,
+                                         uint8_t *col0,
+                                         uint8_t *col1) {
+	uint32_t tx_cost = SSD1306_TX_COST();
+	uint32_t runs_cost = 0;
+	uint32_t rect_cost;
+	uint32_t full_cost;
+	uint8_t first = 0xFFu;
+	uint8_t last = 0;
+	uint8_t left = 0xFFu;
+	uint8_t right = 0;
+	uint8_t page;
+
+	for (page = 0; page < SSD1306_PAGES; page++) {
+		if (SSD1306_TX_DIRTY_MIN[page] > SSD1306_TX_DIRTY_MAX[page]) {
+			continue;
+		}
+
+		/* Data transaction, plus addressing unless the previous page
+		 * ended where the auto-incremented pointer lands on this one
+		 */
+		runs_cost += (uint32_t)(SSD1306_TX_DIRTY_MAX[page] - SSD1306_TX_DIRTY_MIN[page] + 1U) +
+		             tx_cost;
+		if (!(SSD1306_WIDTH == SSD1306_GRAM_COLUMNS && first != 0xFFu && last + 1U == page &&
+		      SSD1306_TX_DIRTY_MAX[last] == SSD1306_WIDTH - 1U && SSD1306_TX_DIRTY_MIN[page] == 0U)) {
+			runs_cost += tx_cost + 3U;
+		}
+
+		if (first == 0xFFu) {
+			first = page;
+		}
+		last = page;
+		left = SSD1306_MIN(left, SSD1306_TX_DIRTY_MIN[page]);
+		right = SSD1306_MAX(right, SSD1306_TX_DIRTY_MAX[page]);
+	}
+
+	if (first == 0xFFu) {
+		return 0;
 	}
 
-	do {
-		/* Process one page at a time: we don't cross page boundary in a single block */
-		last_byte_dirty = 0;
-		page = (uint8_t)(bit_index / SSD1306_WIDTH);
+	rect_cost = ssd1306_window_cost((uint32_t)(last - first + 1U) * (uint32_t)(right - left + 1U), tx_cost) +
+	            SSD1306_WINDOW_COST();
+	full_cost = ssd1306_window_cost(SSD1306_BUFFER_SIZE, tx_cost);
+#if (SSD1306_WIDTH != SSD1306_GRAM_COLUMNS) || (SSD1306_PAGES != SSD1306_GRAM_PAGES)
+	full_cost += SSD1306_WINDOW_COST();
+#endif
 
-		do {
-			dirty_square_index = bit_index / 8u;
+	if (full_cost <= rect_cost && full_cost < runs_cost) {
+		*page0 = 0;
+		*page1 = SSD1306_PAGES - 1U;
+		*col0 = 0;
+		*col1 = SSD1306_WIDTH - 1U;
+		return 1;
+	}
 
-			if (dirty_square_index >= SSD1306_DIRTY_FLAGS_SIZE) {
-				break;
-			}
+	if (rect_cost < runs_cost) {
+		*page0 = first;
+		*page1 = last;
+		*col0 = left;
+		*col1 = right;
+		return 1;
+	}
 
-			dirty_byte = ssd1306_dirty_flags[dirty_square_index];
+	return 0;
+}
 
-			if (dirty_byte == 0xFFu) {
-				/* all 8 bytes in this vertical group are dirty */
-				if (!last_byte_dirty) {
-					batch_start = bit_index % SSD1306_WIDTH;
-				}
+/* Sentinel for the byte budget of ssd1306_flush_page_runs(): no limit */
+#define SSD1306_FLUSH_UNLIMITED 0xFFFFFFFFUL
 
-				batch_len += 8u;
-				bit_index += 8u;
-				last_byte_dirty = 1;
-			} else {
-				/* check individual bits within this 8x8 block */
-				for (i = (uint8_t)(bit_index % 8u); i < 8u; i++) {
-					if ((dirty_byte >> i) & 0x01u) {
-						/* dirty bit */
-						if (!last_byte_dirty) {
-							batch_start = bit_index % SSD1306_WIDTH;
-						}
-
-						batch_len++;
-						last_byte_dirty = 1;
-					} else {
-						/* clean bit */
-						if (last_byte_dirty) {
-							batch_found = 1;
-							bit_index++;
-							break;
-						}
-						last_byte_dirty = 0;
-					}
+/*
+ * Send the dirty bytes of one page, from column 'x' up to the page's
+ * SSD1306_TX_DIRTY_MAX extent, as runs of dirty bytes. Each bit in
+ * SSD1306_TX_DIRTY_FLAGS marks one vertical byte (8 pixels); only the bits
+ * within the extent are scanned, and every run of dirty bytes is sent as
+ * one block; runs separated by at most SSD1306_GAP_MAX() clean bytes
+ * (derived from the active transport) are merged. Addressing commands are sent only where a run does not
+ * start at the controller's auto-incremented write pointer.
+ *
+ * At most '*budget' data bytes are sent (a run is split where it runs
+ * out), and with 'timed' set no block is started once 'elapsed_max'
+ * milliseconds have passed since 'start_ms'. Returns the column where
+ * sending stopped, past the extent when the page is done.
+ */
+static uint16_t ssd1306_flush_page_runs(uint8_t page,
+                                        uint16_t x,
+                                        uint32_t *budget,
+                                        uint8_t timed,
+                                        uint32_t start_ms,
+                                        uint32_t elapsed_max) {
+	const uint8_t *flags = &SSD1306_TX_DIRTY_FLAGS[(uint32_t)page * SSD1306_WIDTH_BYTES];
+	uint16_t x_last = SSD1306_TX_DIRTY_MAX[page];
+	uint32_t gap_max = SSD1306_GAP_MAX();
+	uint16_t run_start;
+	uint16_t gap_end;
+	uint32_t n;
+
+	while (x <= x_last) {
+		/* Skip clean bytes, whole flag bytes at a time when aligned */
+		if ((x % 8u) == 0u && flags[x / 8u] == 0u) {
+			x = (uint16_t)(x + 8u);
+			continue;
+		}
+		if (((flags[x / 8u] >> (x % 8u)) & 0x01u) == 0u) {
+			x++;
+			continue;
+		}
 
-					bit_index++;
+		if (*budget == 0U ||
+		    (timed && (uint32_t)(ssd1306_time_ticks_ms() - start_ms) >= elapsed_max)) {
+			break;
+		}
 
-					/* moved to next 8x8 block */
-					if (dirty_square_index < (bit_index / 8u)) {
-						break;
-					}
+		/* Extend the run over consecutive dirty bytes, whole flag
+		 * bytes at a time when aligned
+		 */
+		run_start = x;
+		for (;;) {
+			while (x <= x_last) {
+				if ((x % 8u) == 0u && flags[x / 8u] == 0xFFu) {
+					x = (uint16_t)(x + 8u);
+				} else if (((flags[x / 8u] >> (x % 8u)) & 0x01u) != 0u) {
+					x++;
+				} else {
+					break;
 				}
 			}
 
-			if (batch_found) {
+			/* Re-sending a short clean gap is cheaper than splitting
+			 * the block (see SSD1306_GAP_MAX): bridge it when
+			 * another dirty byte follows within reach.
+			 */
+			gap_end = x;
+			while (gap_end <= x_last &&
+			       (uint32_t)(gap_end - x) <= gap_max &&
+			       ((flags[gap_end / 8u] >> (gap_end % 8u)) & 0x01u) == 0u) {
+				gap_end++;
+			}
+			if (gap_end > x_last || (uint32_t)(gap_end - x) > gap_max) {
 				break;
 			}
+			x = gap_end;
+		}
+
+		n = SSD1306_MIN((uint32_t)(x - run_start), *budget);
+		if (*budget != SSD1306_FLUSH_UNLIMITED) {
+			*budget -= n;
+		}
+		x = (uint16_t)(run_start + n);
+
+		ssd1306_gram_seek(page, (uint8_t)run_start);
+		ssd1306_send_block((uint8_t)run_start, page, n);
+	}
+
+	return x;
+}
+
+/* Send every dirty page as runs (see ssd1306_flush_page_runs). Cost is
+ * O(pages) plus the width of the dirty intervals.
+ */
+static void ssd1306_flush_all_runs(void) {
+	uint32_t budget = SSD1306_FLUSH_UNLIMITED;
+	uint8_t page;
 
-		} while (page == (bit_index / SSD1306_WIDTH));
+	for (page = 0; page < SSD1306_PAGES; page++) {
+		if (SSD1306_TX_DIRTY_MIN[page] > SSD1306_TX_DIRTY_MAX[page]) {
+			continue;
+		}
+
+		(void)ssd1306_flush_page_runs(page, SSD1306_TX_DIRTY_MIN[page], &budget, 0, 0, 0);
+
+		/* Everything inside the extent has been sent */
+		SSD1306_TX_DIRTY_MIN[page] = 0xFFu;
+		SSD1306_TX_DIRTY_MAX[page] = 0x00u;
+#ifdef SSD1306_SHADOW_HASH
+		ssd1306_page_hash_update(page);
+#endif
+	}
+}
 
-		/* if we ended page with pending block */
-		if (last_byte_dirty) {
-			batch_found = 1;
+#ifdef SSD1306_DOUBLE_BUFFER
+void ssd1306_swap_buffers(void) {
+	/* Bytes outside a page's extent are clean in the back frame and
+	 * therefore already equal in both frames, so copying the extent
+	 * span is enough. Flags are OR-ed in whole bytes: bits beyond the
+	 * extent are zero. Whatever the front frame has not sent yet stays
+	 * dirty there. A transport sending the front frame in place has to
+	 * be done with it first.
+	 */
+	uint32_t offset;
+	uint32_t first_byte;
+	uint32_t last_byte;
+	uint32_t i;
+	uint8_t page;
+	uint8_t x0, x1;
+	uint8_t idle = (ssd1306_transport->write_stable == NULL);
+
+	for (page = 0; page < SSD1306_PAGES; page++) {
+		x0 = ssd1306_dirty_min[page];
+		x1 = ssd1306_dirty_max[page];
+		if (x0 > x1) {
+			continue;
 		}
 
-		if (batch_found) {
-			page = (uint8_t)(dirty_square_index / SSD1306_WIDTH_BYTES);
-			ssd1306_set_page(page);
-			ssd1306_set_column((uint8_t)batch_start);
-			ssd1306_send_block((uint8_t)batch_start, page, batch_len);
+		if (!idle) {
+			(void)ssd1306_wait_idle();
+			idle = 1;
 		}
 
-		batch_found = 0;
-		batch_len = 0;
-		last_byte_dirty = 0;
+		offset = (uint32_t)page * SSD1306_WIDTH;
+		memcpy(&ssd1306_front_buffer[offset + x0], &ssd1306_buffer[offset + x0], (size_t)(x1 - x0 + 1U));
+
+		first_byte = (offset + x0) / 8U;
+		last_byte = (offset + x1) / 8U;
+		for (i = first_byte; i <= last_byte; i++) {
+			ssd1306_front_dirty_flags[i] |= ssd1306_dirty_flags[i];
+			ssd1306_dirty_flags[i] = 0;
+		}
+
+		ssd1306_front_dirty_min[page] = SSD1306_MIN(ssd1306_front_dirty_min[page], x0);
+		ssd1306_front_dirty_max[page] = SSD1306_MAX(ssd1306_front_dirty_max[page], x1);
+		ssd1306_dirty_min[page] = 0xFFu;
+		ssd1306_dirty_max[page] = 0x00u;
+	}
+
+	ssd1306_state.front_start_line = ssd1306_state.start_line;
+}
+#endif
+
+ssd1306_status_t ssd1306_flush_dirty(void) {
+	/* Per-page runs by default; when the cost model prefers it, a
+	 * multi-page rectangle (or the whole frame) is sent instead as one
+	 * stream through a 0x21/0x22 window, without per-page addressing.
+	 */
+	uint8_t page0, page1;
+	uint8_t col0, col1;
+	uint8_t held_min[SSD1306_PAGES];
+	uint8_t held_max[SSD1306_PAGES];
+	ssd1306_status_t rc;
+#ifdef SSD1306_STATS
+	uint32_t transactions_before;
+	uint32_t bytes_before;
+#endif
+
+	if (!ssd1306_state.initialized) {
+		return SSD1306_ERR;
+	}
+
+	rc = ssd1306_link_ready();
+	if (rc != SSD1306_OK) {
+		return rc;
+	}
+	ssd1306_resync_start();
+
+#ifdef SSD1306_STATS
+	transactions_before = ssd1306_stats.transactions;
+	bytes_before = ssd1306_stats.bytes;
+#endif
+
+#ifdef SSD1306_DOUBLE_BUFFER
+	ssd1306_swap_buffers();
+#endif
+
+	ssd1306_scroll_hold(held_min, held_max);
+
+#if defined(SSD1306_SHADOW_GRAM) || defined(SSD1306_SHADOW_HASH)
+	ssd1306_dirty_refine(ssd1306_state.shadow_valid);
+#endif
+
+	ssd1306_bus_flush_begin();
+
+	ssd1306_start_line_sync();
+
+	/* A window could run across scrolling pages */
+	if (ssd1306_state.addr_mode == SSD1306_ADDR_MODE_HORIZONTAL && !ssd1306_state.scroll_active &&
+	    ssd1306_flush_plan_window(&page0, &page1, &col0, &col1)) {
+		ssd1306_send_window(page0, page1, col0, col1);
+	} else {
+		ssd1306_flush_all_runs();
+	}
+
+	ssd1306_scroll_release(held_min, held_max);
+
+	rc = ssd1306_flush_end(0);
+
+#ifdef SSD1306_STATS
+	ssd1306_stats.flushes++;
+	ssd1306_stats.last_flush_transactions = ssd1306_stats.transactions - transactions_before;
+	ssd1306_stats.last_flush_bytes = ssd1306_stats.bytes - bytes_before;
+#endif
+
+	return rc;
+}
+
+#ifdef SSD1306_DOUBLE_BUFFER
+/* Any page with a dirty extent in the given set, scrolling pages aside
+ * (they are sent after the scroll) */
+static uint8_t ssd1306_dirty_any(const uint8_t *dirty_min, const uint8_t *dirty_max) {
+	uint8_t page;
+
+	for (page = 0; page < SSD1306_PAGES; page++) {
+		if (dirty_min[page] <= dirty_max[page] && !ssd1306_scroll_holds(page)) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
+#endif
+
+static uint8_t ssd1306_flush_step_run(uint16_t max_bytes, uint8_t timed, uint32_t deadline_ms) {
+	/* Runs are sent page by page from the resume point, wrapping around
+	 * once, so every page gets its turn however small the budget. Dirty
+	 * flags are cleared only for what has been sent: pixels drawn between
+	 * steps keep their bytes dirty and go out in a later step.
+	 */
+	uint32_t budget = (max_bytes != 0U) ? max_bytes : SSD1306_FLUSH_UNLIMITED;
+	uint32_t start_ms = 0;
+	uint32_t elapsed_max = 0;
+	uint8_t pending = 0;
+	uint8_t visits;
+	uint8_t page;
+	uint16_t x;
+	uint16_t x_from;
+	uint8_t extent_min;
+	uint8_t extent_max;
+	uint8_t held_min[SSD1306_PAGES];
+	uint8_t held_max[SSD1306_PAGES];
+#ifdef SSD1306_STATS
+	uint32_t transactions_before;
+	uint32_t bytes_before;
+#endif
+
+	if (!ssd1306_state.initialized) {
+		return 0;
+	}
+
+	if (ssd1306_link_ready() != SSD1306_OK) {
+		return 0;
+	}
+	ssd1306_resync_start();
+
+	if (timed) {
+		/* Compared as time elapsed since the call, which stays correct
+		 * when the tick counter wraps
+		 */
+		start_ms = ssd1306_time_ticks_ms();
+		if ((int32_t)(deadline_ms - start_ms) > 0) {
+			elapsed_max = deadline_ms - start_ms;
+		}
+	}
+
+#ifdef SSD1306_STATS
+	transactions_before = ssd1306_stats.transactions;
+	bytes_before = ssd1306_stats.bytes;
+#endif
+
+#ifdef SSD1306_DOUBLE_BUFFER
+	/* Take the next frame only when the previous one is fully sent, so
+	 * the panel always settles on whole frames
+	 */
+	if (!ssd1306_dirty_any(SSD1306_TX_DIRTY_MIN, SSD1306_TX_DIRTY_MAX)) {
+		ssd1306_swap_buffers();
+	}
+#endif
+
+	ssd1306_scroll_hold(held_min, held_max);
+
+#if defined(SSD1306_SHADOW_GRAM) || defined(SSD1306_SHADOW_HASH)
+	ssd1306_dirty_refine(ssd1306_state.shadow_valid);
+#endif
+
+	ssd1306_bus_flush_begin();
+
+	ssd1306_start_line_sync();
+
+	for (visits = 0; visits <= SSD1306_PAGES; visits++) {
+		page = ssd1306_state.flush_page;
+		extent_min = SSD1306_TX_DIRTY_MIN[page];
+		extent_max = SSD1306_TX_DIRTY_MAX[page];
+
+		if (extent_min <= extent_max) {
+			x_from = SSD1306_MAX((uint16_t)ssd1306_state.flush_column, (uint16_t)extent_min);
+			x = ssd1306_flush_page_runs(page, x_from, &budget, timed, start_ms, elapsed_max);
+
+			if (x <= extent_max) {
+				/* Out of budget: everything before 'x' is sent when the
+				 * page was started at its extent
+				 */
+				if (x_from == extent_min && SSD1306_TX_DIRTY_MIN[page] <= SSD1306_TX_DIRTY_MAX[page]) {
+					SSD1306_TX_DIRTY_MIN[page] = (uint8_t)x;
+				}
+#ifdef SSD1306_SHADOW_HASH
+				ssd1306_page_hash_update(page);
+#endif
+				ssd1306_state.flush_column = (uint8_t)x;
+				pending = 1;
+				break;
+			}
+
+			/* Bytes before a resume point are visited again at the end
+			 * of the round; from the extent start, the page is done
+			 */
+			if (x_from == extent_min) {
+				SSD1306_TX_DIRTY_MIN[page] = 0xFFu;
+				SSD1306_TX_DIRTY_MAX[page] = 0x00u;
+			}
+#ifdef SSD1306_SHADOW_HASH
+			ssd1306_page_hash_update(page);
+#endif
+		}
+
+		ssd1306_state.flush_page = (uint8_t)((page + 1U) % SSD1306_PAGES);
+		ssd1306_state.flush_column = 0;
+	}
+
+#ifdef SSD1306_DOUBLE_BUFFER
+	if (!pending) {
+		pending = ssd1306_dirty_any(ssd1306_dirty_min, ssd1306_dirty_max);
+	}
+#endif
+
+	ssd1306_scroll_release(held_min, held_max);
+
+	if (ssd1306_flush_end(pending) != SSD1306_OK) {
+		/* The whole frame goes out again */
+		pending = 1;
+	}
+
+#ifdef SSD1306_STATS
+	ssd1306_stats.flushes++;
+	ssd1306_stats.last_flush_transactions = ssd1306_stats.transactions - transactions_before;
+	ssd1306_stats.last_flush_bytes = ssd1306_stats.bytes - bytes_before;
+#endif
+
+	return pending;
+}
+
+uint8_t ssd1306_flush_step(uint16_t max_bytes) {
+	return ssd1306_flush_step_run(max_bytes, 0, 0);
+}
+
+uint8_t ssd1306_flush_step_ex(uint16_t max_bytes, uint32_t deadline_ms) {
+	return ssd1306_flush_step_run(max_bytes, 1, deadline_ms);
+}
+
+ssd1306_status_t ssd1306_flush_status(void) {
+	return ssd1306_flush_last;
+}
+
+uint8_t ssd1306_busy(void) {
+	if (ssd1306_transport->busy) {
+		return ssd1306_transport->busy(ssd1306_transport->ctx);
+	}
+
+	return 0;
+}
+
+ssd1306_status_t ssd1306_wait_idle(void) {
+	ssd1306_status_t rc = SSD1306_OK;
+
+	if (ssd1306_transport->wait_idle) {
+		rc = ssd1306_transport->wait_idle(ssd1306_transport->ctx);
+	}
+
+	/* An asynchronous transport reports failed transactions only here */
+	if (rc != SSD1306_OK) {
+		ssd1306_link_report(rc);
+	}
 
-	} while (bit_index < SSD1306_DIRTY_FLAGS_SIZE * 8u - 1u);
-	/* bit_index iterates over all bits of ssd1306_dirty_flags */
+	return rc;
 }
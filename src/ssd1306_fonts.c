@@ -3177,23 +3177,43 @@ const uint8_t FONT_7x14_ARRAY[] = {
 
 
 #ifdef SSD1306_INCLUDE_FONT_8x8
-	const SSD1306_Font_t font_8x8 = {8, 8, FONT_8x8_ARRAY};
+#ifdef SSD1306_FONT_USE_PAGE_MAJOR
+	const SSD1306_Font_t font_8x8 = {8, 8, FONT_8x8_PAGES_ARRAY, SSD1306_FONT_LAYOUT_PAGE_MAJOR};
+#else
+	const SSD1306_Font_t font_8x8 = {8, 8, FONT_8x8_ARRAY, SSD1306_FONT_LAYOUT_ROW_MAJOR};
+#endif
 #endif
 
 #ifdef SSD1306_INCLUDE_FONT_7x11
-	const SSD1306_Font_t font_7x11 = {7, 11, FONT_7x11_ARRAY};
+#ifdef SSD1306_FONT_USE_PAGE_MAJOR
+	const SSD1306_Font_t font_7x11 = {7, 11, FONT_7x11_PAGES_ARRAY, SSD1306_FONT_LAYOUT_PAGE_MAJOR};
+#else
+	const SSD1306_Font_t font_7x11 = {7, 11, FONT_7x11_ARRAY, SSD1306_FONT_LAYOUT_ROW_MAJOR};
+#endif
 #endif
 
 #ifdef SSD1306_INCLUDE_FONT_7x14
-	const SSD1306_Font_t font_7x14 = {7, 14, FONT_7x14_ARRAY};
+#ifdef SSD1306_FONT_USE_PAGE_MAJOR
+	const SSD1306_Font_t font_7x14 = {7, 14, FONT_7x14_PAGES_ARRAY, SSD1306_FONT_LAYOUT_PAGE_MAJOR};
+#else
+	const SSD1306_Font_t font_7x14 = {7, 14, FONT_7x14_ARRAY, SSD1306_FONT_LAYOUT_ROW_MAJOR};
+#endif
 #endif
 
 #ifdef SSD1306_INCLUDE_FONT_11x21
-	const SSD1306_Font_t font_11x21 = {11, 21, FONT_11x21_ARRAY};
+#ifdef SSD1306_FONT_USE_PAGE_MAJOR
+	const SSD1306_Font_t font_11x21 = {11, 21, FONT_11x21_PAGES_ARRAY, SSD1306_FONT_LAYOUT_PAGE_MAJOR};
+#else
+	const SSD1306_Font_t font_11x21 = {11, 21, FONT_11x21_ARRAY, SSD1306_FONT_LAYOUT_ROW_MAJOR};
+#endif
 #endif
 
 #ifdef SSD1306_INCLUDE_FONT_16x30
-	const SSD1306_Font_t font_16x30 = {16, 30, FONT_16x30_ARRAY};
+#ifdef SSD1306_FONT_USE_PAGE_MAJOR
+	const SSD1306_Font_t font_16x30 = {16, 30, FONT_16x30_PAGES_ARRAY, SSD1306_FONT_LAYOUT_PAGE_MAJOR};
+#else
+	const SSD1306_Font_t font_16x30 = {16, 30, FONT_16x30_ARRAY, SSD1306_FONT_LAYOUT_ROW_MAJOR};
+#endif
 #endif
 
 
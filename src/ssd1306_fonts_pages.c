@@ -0,0 +1,2727 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Даниил Еремеев
+ * See LICENSE file for details.
+ */
+
+/*
+ * Built-in fonts in SSD1306 page-major (GRAM) layout.
+ * Generated by tools/ssd1306_fontconv.c from src/ssd1306_fonts.c - do not edit.
+ */
+
+#include <stdint.h>
+#include "ssd1306_fonts.h"
+
+#if defined(SSD1306_FONT_USE_PAGE_MAJOR) && defined(SSD1306_INCLUDE_FONT_8x8)
+const uint8_t FONT_8x8_PAGES_ARRAY[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x20 */
+	0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x00, /* 0x21 */
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, /* 0x22 */
+	0x00, 0x14, 0x7F, 0x14, 0x14, 0x7F, 0x14, 0x00, /* 0x23 */
+	0x00, 0x24, 0x2A, 0x6B, 0x6B, 0x2A, 0x12, 0x00, /* 0x24 */
+	0x00, 0x46, 0x26, 0x10, 0x08, 0x64, 0x62, 0x00, /* 0x25 */
+	0x30, 0x4A, 0x45, 0x4D, 0x32, 0x48, 0x48, 0x00, /* 0x26 */
+	0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, /* 0x27 */
+	0x00, 0x1C, 0x22, 0x41, 0x00, 0x00, 0x00, 0x00, /* 0x28 */
+	0x00, 0x00, 0x41, 0x22, 0x1C, 0x00, 0x00, 0x00, /* 0x29 */
+	0x08, 0x2A, 0x1C, 0x1C, 0x1C, 0x2A, 0x08, 0x00, /* 0x2A */
+	0x00, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x00, 0x00, /* 0x2B */
+	0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, /* 0x2C */
+	0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, /* 0x2D */
+	0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, /* 0x2E */
+	0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, /* 0x2F */
+	0x00, 0x3E, 0x41, 0x49, 0x49, 0x41, 0x3E, 0x00, /* 0x30 */
+	0x00, 0x00, 0x04, 0x42, 0x7F, 0x40, 0x00, 0x00, /* 0x31 */
+	0x00, 0x72, 0x51, 0x51, 0x51, 0x51, 0x4E, 0x00, /* 0x32 */
+	0x00, 0x22, 0x41, 0x49, 0x49, 0x49, 0x36, 0x00, /* 0x33 */
+	0x00, 0x10, 0x18, 0x14, 0x52, 0x7F, 0x50, 0x00, /* 0x34 */
+	0x00, 0x27, 0x45, 0x45, 0x45, 0x45, 0x39, 0x00, /* 0x35 */
+	0x00, 0x3C, 0x4A, 0x49, 0x49, 0x49, 0x30, 0x00, /* 0x36 */
+	0x00, 0x03, 0x01, 0x71, 0x09, 0x05, 0x03, 0x00, /* 0x37 */
+	0x00, 0x36, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00, /* 0x38 */
+	0x00, 0x06, 0x49, 0x49, 0x49, 0x29, 0x1E, 0x00, /* 0x39 */
+	0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, /* 0x3A */
+	0x00, 0x00, 0x80, 0x66, 0x00, 0x00, 0x00, 0x00, /* 0x3B */
+	0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x00, /* 0x3C */
+	0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, /* 0x3D */
+	0x00, 0x00, 0x00, 0x41, 0x22, 0x14, 0x08, 0x00, /* 0x3E */
+	0x00, 0x02, 0x01, 0x01, 0x51, 0x09, 0x06, 0x00, /* 0x3F */
+	0x00, 0x3E, 0x41, 0x5D, 0x55, 0x55, 0x1E, 0x00, /* 0x40 */
+	0x00, 0x7C, 0x12, 0x11, 0x11, 0x12, 0x7C, 0x00, /* 0x41 */
+	0x00, 0x41, 0x7F, 0x49, 0x49, 0x49, 0x36, 0x00, /* 0x42 */
+	0x00, 0x1C, 0x22, 0x41, 0x41, 0x41, 0x22, 0x00, /* 0x43 */
+	0x00, 0x41, 0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00, /* 0x44 */
+	0x00, 0x41, 0x7F, 0x49, 0x5D, 0x41, 0x63, 0x00, /* 0x45 */
+	0x00, 0x41, 0x7F, 0x49, 0x1D, 0x01, 0x03, 0x00, /* 0x46 */
+	0x00, 0x1C, 0x22, 0x41, 0x51, 0x51, 0x72, 0x00, /* 0x47 */
+	0x00, 0x7F, 0x08, 0x08, 0x08, 0x08, 0x7F, 0x00, /* 0x48 */
+	0x00, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x00, 0x00, /* 0x49 */
+	0x00, 0x30, 0x40, 0x40, 0x41, 0x3F, 0x01, 0x00, /* 0x4A */
+	0x00, 0x41, 0x7F, 0x08, 0x14, 0x22, 0x41, 0x40, /* 0x4B */
+	0x00, 0x41, 0x7F, 0x41, 0x40, 0x40, 0x60, 0x00, /* 0x4C */
+	0x00, 0x7F, 0x01, 0x02, 0x04, 0x02, 0x01, 0x7F, /* 0x4D */
+	0x00, 0x7F, 0x01, 0x02, 0x04, 0x08, 0x7F, 0x00, /* 0x4E */
+	0x00, 0x3E, 0x41, 0x41, 0x41, 0x41, 0x3E, 0x00, /* 0x4F */
+	0x00, 0x41, 0x7F, 0x49, 0x09, 0x09, 0x06, 0x00, /* 0x50 */
+	0x00, 0x1E, 0x21, 0x21, 0x31, 0x21, 0x5E, 0x40, /* 0x51 */
+	0x00, 0x41, 0x7F, 0x49, 0x19, 0x29, 0x46, 0x00, /* 0x52 */
+	0x00, 0x26, 0x49, 0x49, 0x49, 0x49, 0x32, 0x00, /* 0x53 */
+	0x00, 0x03, 0x01, 0x41, 0x7F, 0x41, 0x01, 0x03, /* 0x54 */
+	0x00, 0x3F, 0x40, 0x40, 0x40, 0x40, 0x3F, 0x00, /* 0x55 */
+	0x00, 0x0F, 0x10, 0x20, 0x40, 0x20, 0x10, 0x0F, /* 0x56 */
+	0x00, 0x3F, 0x40, 0x40, 0x38, 0x40, 0x40, 0x3F, /* 0x57 */
+	0x00, 0x41, 0x22, 0x14, 0x08, 0x14, 0x22, 0x41, /* 0x58 */
+	0x00, 0x01, 0x02, 0x44, 0x78, 0x44, 0x02, 0x01, /* 0x59 */
+	0x00, 0x43, 0x61, 0x51, 0x49, 0x45, 0x43, 0x61, /* 0x5A */
+	0x00, 0x7F, 0x41, 0x41, 0x41, 0x00, 0x00, 0x00, /* 0x5B */
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, /* 0x5C */
+	0x00, 0x41, 0x41, 0x41, 0x7F, 0x00, 0x00, 0x00, /* 0x5D */
+	0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x00, /* 0x5E */
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, /* 0x5F */
+	0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x00, /* 0x60 */
+	0x00, 0x20, 0x54, 0x54, 0x54, 0x54, 0x78, 0x40, /* 0x61 */
+	0x00, 0x01, 0x7F, 0x30, 0x48, 0x48, 0x48, 0x30, /* 0x62 */
+	0x00, 0x38, 0x44, 0x44, 0x44, 0x44, 0x28, 0x00, /* 0x63 */
+	0x00, 0x30, 0x48, 0x48, 0x48, 0x31, 0x7F, 0x40, /* 0x64 */
+	0x00, 0x38, 0x54, 0x54, 0x54, 0x54, 0x18, 0x00, /* 0x65 */
+	0x00, 0x00, 0x48, 0x7E, 0x49, 0x01, 0x02, 0x00, /* 0x66 */
+	0x00, 0x98, 0xA4, 0xA4, 0xA4, 0xA4, 0x78, 0x04, /* 0x67 */
+	0x00, 0x41, 0x7F, 0x08, 0x04, 0x04, 0x78, 0x00, /* 0x68 */
+	0x00, 0x00, 0x44, 0x7D, 0x40, 0x00, 0x00, 0x00, /* 0x69 */
+	0x00, 0x60, 0x80, 0x80, 0x80, 0x84, 0x7D, 0x00, /* 0x6A */
+	0x00, 0x01, 0x7F, 0x10, 0x28, 0x44, 0x40, 0x00, /* 0x6B */
+	0x00, 0x00, 0x41, 0x7F, 0x40, 0x00, 0x00, 0x00, /* 0x6C */
+	0x00, 0x7C, 0x04, 0x04, 0x78, 0x04, 0x04, 0x78, /* 0x6D */
+	0x00, 0x7C, 0x08, 0x04, 0x04, 0x04, 0x78, 0x00, /* 0x6E */
+	0x00, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00, /* 0x6F */
+	0x00, 0x84, 0xFC, 0x98, 0x24, 0x24, 0x18, 0x00, /* 0x70 */
+	0x00, 0x18, 0x24, 0x24, 0x98, 0xFC, 0x84, 0x00, /* 0x71 */
+	0x00, 0x44, 0x7C, 0x48, 0x04, 0x04, 0x18, 0x00, /* 0x72 */
+	0x00, 0x48, 0x54, 0x54, 0x54, 0x54, 0x24, 0x00, /* 0x73 */
+	0x00, 0x04, 0x04, 0x3F, 0x44, 0x44, 0x20, 0x00, /* 0x74 */
+	0x00, 0x3C, 0x40, 0x40, 0x40, 0x20, 0x7C, 0x00, /* 0x75 */
+	0x00, 0x0C, 0x10, 0x20, 0x40, 0x20, 0x10, 0x0C, /* 0x76 */
+	0x00, 0x3C, 0x40, 0x40, 0x38, 0x40, 0x40, 0x3C, /* 0x77 */
+	0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00, /* 0x78 */
+	0x00, 0x9C, 0xA0, 0xA0, 0xA0, 0xA0, 0x7C, 0x00, /* 0x79 */
+	0x00, 0x44, 0x64, 0x54, 0x4C, 0x44, 0x00, 0x00, /* 0x7A */
+	0x00, 0x08, 0x08, 0x36, 0x41, 0x41, 0x00, 0x00, /* 0x7B */
+	0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, /* 0x7C */
+	0x00, 0x00, 0x41, 0x41, 0x36, 0x08, 0x08, 0x00, /* 0x7D */
+	0x00, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x00, /* 0x7E */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x7F */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x80 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x81 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x82 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x83 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x84 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x85 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x86 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x87 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x88 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x89 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x8A */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x8B */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x8C */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x8D */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x8E */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, /* 0x8F */
+	0x18, 0x18, 0x18, 0xFF, 0xFF, 0x00, 0x00, 0x00, /* 0x90 */
+	0x14, 0x14, 0x14, 0xFF, 0x00, 0x00, 0x00, 0x00, /* 0x91 */
+	0x10, 0x10, 0x10, 0xFF, 0x00, 0xFF, 0x00, 0x00, /* 0x92 */
+	0x10, 0x10, 0x10, 0xF0, 0x10, 0xF0, 0x00, 0x00, /* 0x93 */
+	0x14, 0x14, 0x14, 0xFC, 0x00, 0x00, 0x00, 0x00, /* 0x94 */
+	0x14, 0x14, 0x14, 0xF7, 0x00, 0xFF, 0x00, 0x00, /* 0x95 */
+	0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, /* 0x96 */
+	0x14, 0x14, 0x14, 0xF4, 0x04, 0xFC, 0x00, 0x00, /* 0x97 */
+	0x14, 0x14, 0x14, 0x17, 0x10, 0x1F, 0x00, 0x00, /* 0x98 */
+	0x10, 0x10, 0x10, 0x1F, 0x10, 0x1F, 0x00, 0x00, /* 0x99 */
+	0x14, 0x14, 0x14, 0x1F, 0x00, 0x00, 0x00, 0x00, /* 0x9A */
+	0x18, 0x18, 0x18, 0xF8, 0xF8, 0x00, 0x00, 0x00, /* 0x9B */
+	0x00, 0x00, 0x00, 0x1F, 0x1F, 0x18, 0x18, 0x18, /* 0x9C */
+	0x18, 0x18, 0x18, 0x1F, 0x1F, 0x18, 0x18, 0x18, /* 0x9D */
+	0x18, 0x18, 0x18, 0xF8, 0xF8, 0x18, 0x18, 0x18, /* 0x9E */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x18, 0x18, 0x18, /* 0x9F */
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, /* 0xA0 */
+	0x10, 0x10, 0x10, 0xFF, 0x10, 0x10, 0x10, 0x10, /* 0xA1 */
+	0x00, 0x00, 0x00, 0xFF, 0x14, 0x14, 0x14, 0x14, /* 0xA2 */
+	0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x10, 0x10, /* 0xA3 */
+	0x00, 0x00, 0x00, 0x1F, 0x10, 0x17, 0x14, 0x14, /* 0xA4 */
+	0x00, 0x00, 0x00, 0xFC, 0x04, 0xF4, 0x14, 0x14, /* 0xA5 */
+	0x14, 0x14, 0x14, 0x17, 0x10, 0x17, 0x14, 0x14, /* 0xA6 */
+	0x14, 0x14, 0x14, 0xF4, 0x04, 0xF4, 0x14, 0x14, /* 0xA7 */
+	0x82, 0xFE, 0x93, 0x92, 0xBA, 0x83, 0xC6, 0x00, /* 0xA8 */
+	0x00, 0x00, 0x00, 0xFF, 0x00, 0xF7, 0x14, 0x14, /* 0xA9 */
+	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, /* 0xAA */
+	0x00, 0x08, 0x14, 0x22, 0x08, 0x14, 0x22, 0x00, /* 0xAB */
+	0x14, 0x14, 0x14, 0xF7, 0x00, 0xF7, 0x14, 0x14, /* 0xAC */
+	0x14, 0x14, 0x14, 0x17, 0x14, 0x14, 0x14, 0x14, /* 0xAD */
+	0x10, 0x10, 0x10, 0x1F, 0x10, 0x1F, 0x10, 0x10, /* 0xAE */
+	0x14, 0x14, 0x14, 0xFC, 0xFC, 0x14, 0x14, 0x14, /* 0xAF */
+	0x00, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, /* 0xB0 */
+	0xD4, 0x74, 0x34, 0xFC, 0xFC, 0x34, 0x74, 0xD4, /* 0xB1 */
+	0x00, 0x00, 0x00, 0x1F, 0x10, 0x1F, 0x10, 0x10, /* 0xB2 */
+	0x00, 0x00, 0x00, 0x1F, 0x14, 0x14, 0x14, 0x14, /* 0xB3 */
+	0x00, 0x00, 0x00, 0xFC, 0x14, 0x14, 0x14, 0x14, /* 0xB4 */
+	0x00, 0x00, 0x00, 0xF0, 0x10, 0xF0, 0x10, 0x10, /* 0xB5 */
+	0x10, 0x10, 0x10, 0xFF, 0x10, 0xFF, 0x10, 0x10, /* 0xB6 */
+	0x14, 0x14, 0x14, 0xFF, 0x14, 0x14, 0x14, 0x14, /* 0xB7 */
+	0x00, 0x38, 0x55, 0x54, 0x54, 0x55, 0x18, 0x00, /* 0xB8 */
+	0x78, 0x08, 0x08, 0x70, 0x00, 0x16, 0x16, 0x00, /* 0xB9 */
+	0x18, 0x18, 0x18, 0x1F, 0x1F, 0x00, 0x00, 0x00, /* 0xBA */
+	0x00, 0x22, 0x14, 0x08, 0x22, 0x14, 0x08, 0x00, /* 0xBB */
+	0x00, 0x00, 0x00, 0xF8, 0xF8, 0x18, 0x18, 0x18, /* 0xBC */
+	0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00, /* 0xBD */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, /* 0xBE */
+	0x00, 0x4E, 0x71, 0x01, 0x01, 0x71, 0x4E, 0x00, /* 0xBF */
+	0x00, 0x7C, 0x12, 0x11, 0x11, 0x12, 0x7C, 0x00, /* 0xC0 */
+	0x00, 0x41, 0x7F, 0x49, 0x49, 0x49, 0x33, 0x00, /* 0xC1 */
+	0x00, 0x41, 0x7F, 0x49, 0x49, 0x49, 0x36, 0x00, /* 0xC2 */
+	0x00, 0x41, 0x7F, 0x41, 0x01, 0x01, 0x03, 0x00, /* 0xC3 */
+	0x00, 0x60, 0x3E, 0x21, 0x21, 0x3F, 0x60, 0x00, /* 0xC4 */
+	0x00, 0x41, 0x7F, 0x49, 0x5D, 0x41, 0x63, 0x00, /* 0xC5 */
+	0x00, 0x00, 0x63, 0x14, 0x7F, 0x14, 0x63, 0x00, /* 0xC6 */
+	0x00, 0x22, 0x41, 0x49, 0x49, 0x49, 0x36, 0x00, /* 0xC7 */
+	0x00, 0x7F, 0x20, 0x10, 0x08, 0x04, 0x7F, 0x00, /* 0xC8 */
+	0x00, 0x7F, 0x20, 0x11, 0x09, 0x04, 0x7F, 0x00, /* 0xC9 */
+	0x00, 0x41, 0x7F, 0x08, 0x14, 0x22, 0x41, 0x00, /* 0xCA */
+	0x40, 0x7C, 0x02, 0x01, 0x01, 0x7F, 0x00, 0x00, /* 0xCB */
+	0x00, 0x7F, 0x01, 0x02, 0x04, 0x02, 0x01, 0x7F, /* 0xCC */
+	0x00, 0x7F, 0x08, 0x08, 0x08, 0x08, 0x7F, 0x00, /* 0xCD */
+	0x00, 0x3E, 0x41, 0x41, 0x41, 0x41, 0x3E, 0x00, /* 0xCE */
+	0x00, 0x7F, 0x01, 0x01, 0x01, 0x01, 0x7F, 0x00, /* 0xCF */
+	0x00, 0x41, 0x7F, 0x49, 0x09, 0x09, 0x06, 0x00, /* 0xD0 */
+	0x00, 0x1C, 0x22, 0x41, 0x41, 0x41, 0x22, 0x00, /* 0xD1 */
+	0x00, 0x03, 0x01, 0x41, 0x7F, 0x41, 0x01, 0x03, /* 0xD2 */
+	0x00, 0x27, 0x48, 0x48, 0x48, 0x48, 0x3F, 0x00, /* 0xD3 */
+	0x00, 0x0E, 0x11, 0x51, 0x7F, 0x51, 0x11, 0x0E, /* 0xD4 */
+	0x00, 0x41, 0x22, 0x14, 0x08, 0x14, 0x22, 0x41, /* 0xD5 */
+	0x00, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x7F, 0xC0, /* 0xD6 */
+	0x00, 0x07, 0x08, 0x08, 0x08, 0x48, 0x7F, 0x40, /* 0xD7 */
+	0x00, 0x7F, 0x40, 0x40, 0x7E, 0x40, 0x40, 0x7F, /* 0xD8 */
+	0x00, 0x7F, 0x40, 0x40, 0x7F, 0x40, 0x40, 0xFF, /* 0xD9 */
+	0x00, 0x03, 0x01, 0x7F, 0x48, 0x48, 0x30, 0x00, /* 0xDA */
+	0x00, 0x7F, 0x48, 0x48, 0x30, 0x00, 0x7F, 0x00, /* 0xDB */
+	0x00, 0x00, 0x7F, 0x48, 0x48, 0x30, 0x00, 0x00, /* 0xDC */
+	0x00, 0x22, 0x49, 0x49, 0x49, 0x2A, 0x1C, 0x00, /* 0xDD */
+	0x00, 0x7F, 0x08, 0x3E, 0x41, 0x41, 0x3E, 0x00, /* 0xDE */
+	0x00, 0x46, 0x29, 0x19, 0x09, 0x7F, 0x00, 0x00, /* 0xDF */
+	0x00, 0x20, 0x54, 0x54, 0x54, 0x54, 0x78, 0x00, /* 0xE0 */
+	0x00, 0x7C, 0x54, 0x54, 0x54, 0x54, 0x20, 0x00, /* 0xE1 */
+	0x00, 0x7C, 0x54, 0x54, 0x54, 0x54, 0x28, 0x00, /* 0xE2 */
+	0x00, 0x7C, 0x04, 0x04, 0x04, 0x04, 0x0C, 0x00, /* 0xE3 */
+	0x00, 0x30, 0x4A, 0x4A, 0x4A, 0x4A, 0x3C, 0x00, /* 0xE4 */
+	0x00, 0x38, 0x54, 0x54, 0x54, 0x54, 0x18, 0x00, /* 0xE5 */
+	0x00, 0x00, 0x6C, 0x10, 0x7C, 0x10, 0x6C, 0x00, /* 0xE6 */
+	0x00, 0x44, 0x54, 0x54, 0x54, 0x54, 0x28, 0x00, /* 0xE7 */
+	0x00, 0x00, 0x7C, 0x20, 0x10, 0x08, 0x7C, 0x00, /* 0xE8 */
+	0x00, 0x00, 0x7C, 0x20, 0x12, 0x08, 0x7C, 0x00, /* 0xE9 */
+	0x00, 0x7C, 0x10, 0x10, 0x10, 0x28, 0x44, 0x00, /* 0xEA */
+	0x00, 0x40, 0x38, 0x04, 0x04, 0x04, 0x7C, 0x00, /* 0xEB */
+	0x00, 0x7C, 0x08, 0x10, 0x10, 0x08, 0x7C, 0x00, /* 0xEC */
+	0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, /* 0xED */
+	0x00, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00, /* 0xEE */
+	0x00, 0x7C, 0x04, 0x04, 0x04, 0x04, 0x7C, 0x00, /* 0xEF */
+	0x00, 0xFC, 0x24, 0x24, 0x24, 0x24, 0x18, 0x00, /* 0xF0 */
+	0x00, 0x38, 0x44, 0x44, 0x44, 0x44, 0x28, 0x00, /* 0xF1 */
+	0x00, 0x00, 0x04, 0x04, 0x7C, 0x04, 0x04, 0x00, /* 0xF2 */
+	0x00, 0x9C, 0xA0, 0xA0, 0xA0, 0xA0, 0x7C, 0x00, /* 0xF3 */
+	0x00, 0x18, 0x24, 0x24, 0xFC, 0x24, 0x24, 0x18, /* 0xF4 */
+	0x00, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, /* 0xF5 */
+	0x00, 0x7C, 0x40, 0x40, 0x40, 0x40, 0x7C, 0xC0, /* 0xF6 */
+	0x00, 0x0C, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, /* 0xF7 */
+	0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x7C, /* 0xF8 */
+	0x00, 0x7C, 0x40, 0x40, 0x7C, 0x40, 0x40, 0xFC, /* 0xF9 */
+	0x00, 0x04, 0x04, 0x7C, 0x50, 0x50, 0x20, 0x00, /* 0xFA */
+	0x00, 0x7C, 0x50, 0x50, 0x20, 0x00, 0x7C, 0x00, /* 0xFB */
+	0x00, 0x00, 0x7C, 0x50, 0x50, 0x50, 0x20, 0x00, /* 0xFC */
+	0x00, 0x28, 0x44, 0x54, 0x54, 0x54, 0x38, 0x00, /* 0xFD */
+	0x00, 0x7C, 0x10, 0x38, 0x44, 0x44, 0x38, 0x00, /* 0xFE */
+	0x00, 0x00, 0x48, 0x34, 0x14, 0x14, 0x7C, 0x00, /* 0xFF */
+};
+#endif
+
+#if defined(SSD1306_FONT_USE_PAGE_MAJOR) && defined(SSD1306_INCLUDE_FONT_7x11)
+const uint8_t FONT_7x11_PAGES_ARRAY[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x20 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, /* 0x21 */
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x00, /* 0x22 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x40, 0xD0, 0x78, 0xD0, 0x78, 0x10, 0x00, /* 0x23 */
+	0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0xE4, 0x3E, 0xC4, 0x00, 0x00, /* 0x24 */
+	0x00, 0x01, 0x03, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0xD4, 0xA8, 0x58, 0x84, 0x00, /* 0x25 */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0xC0, 0x28, 0x34, 0xC8, 0x20, 0x00, /* 0x26 */
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, /* 0x27 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xF0, 0x08, 0x04, 0x04, 0x00, 0x00, /* 0x28 */
+	0x00, 0x01, 0x02, 0x04, 0x04, 0x00, 0x00,
+	0x00, 0x04, 0x04, 0x08, 0xF0, 0x00, 0x00, /* 0x29 */
+	0x00, 0x04, 0x04, 0x02, 0x01, 0x00, 0x00,
+	0x00, 0x54, 0x38, 0x38, 0x54, 0x00, 0x00, /* 0x2A */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x20, 0xF8, 0x20, 0x20, 0x00, /* 0x2B */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x2C */
+	0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, /* 0x2D */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x2E */
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xC0, 0x38, 0x04, 0x00, 0x00, /* 0x2F */
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xF8, 0x44, 0x24, 0x14, 0xF8, 0x00, /* 0x30 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x08, 0x04, 0xFC, 0x00, 0x00, 0x00, /* 0x31 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x04, 0x84, 0x64, 0x18, 0x00, 0x00, /* 0x32 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x04, 0x34, 0x2C, 0xC4, 0x00, 0x00, /* 0x33 */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x60, 0x50, 0x48, 0xFC, 0x40, 0x00, /* 0x34 */
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x3C, 0x24, 0x24, 0xC4, 0x00, 0x00, /* 0x35 */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xF0, 0x28, 0x24, 0xC0, 0x00, 0x00, /* 0x36 */
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0xC4, 0x34, 0x0C, 0x00, 0x00, /* 0x37 */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xD8, 0x24, 0x24, 0xD8, 0x00, 0x00, /* 0x38 */
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x24, 0xA4, 0x78, 0x00, 0x00, /* 0x39 */
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, /* 0x3A */
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, /* 0x3B */
+	0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x20, 0x50, 0x50, 0x88, 0x00, 0x00, /* 0x3C */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x00, 0x00, /* 0x3D */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x88, 0x50, 0x50, 0x20, 0x20, 0x00, 0x00, /* 0x3E */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x04, 0x44, 0x24, 0x18, 0x00, 0x00, /* 0x3F */
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xC0, 0x20, 0x90, 0x50, 0xE0, 0x00, /* 0x40 */
+	0x00, 0x03, 0x04, 0x04, 0x05, 0x05, 0x00,
+	0x00, 0x80, 0x70, 0x4C, 0x70, 0x80, 0x00, /* 0x41 */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xFC, 0x24, 0x24, 0x24, 0xD8, 0x00, /* 0x42 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xF8, 0x04, 0x04, 0x04, 0x8C, 0x00, /* 0x43 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0xFC, 0x04, 0x04, 0x04, 0xF8, 0x00, /* 0x44 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xFC, 0x24, 0x24, 0x24, 0x00, 0x00, /* 0x45 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xFC, 0x24, 0x24, 0x24, 0x00, 0x00, /* 0x46 */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xF8, 0x04, 0x04, 0x44, 0xCC, 0x00, /* 0x47 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0xFC, 0x20, 0x20, 0x20, 0xFC, 0x00, /* 0x48 */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x04, 0x04, 0xFC, 0x04, 0x04, 0x00, /* 0x49 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x04, 0x04, 0x04, 0xFC, 0x00, 0x00, /* 0x4A */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xFC, 0x20, 0x50, 0x88, 0x04, 0x00, /* 0x4B */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xFC, 0x00, 0x00, 0x80, 0x00, 0x00, /* 0x4C */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xFC, 0x08, 0x30, 0x08, 0xFC, 0x00, /* 0x4D */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xFC, 0x18, 0x20, 0xC0, 0xFC, 0x00, /* 0x4E */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xF8, 0x04, 0x04, 0x04, 0xF8, 0x00, /* 0x4F */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xFC, 0x24, 0x24, 0x18, 0x00, 0x00, /* 0x50 */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xF8, 0x04, 0x04, 0x04, 0xF8, 0x00, /* 0x51 */
+	0x00, 0x00, 0x01, 0x03, 0x05, 0x04, 0x00,
+	0x00, 0xFC, 0x24, 0x64, 0x98, 0x00, 0x00, /* 0x52 */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x98, 0x24, 0x24, 0x24, 0xCC, 0x00, /* 0x53 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x0C, 0x04, 0xFC, 0x04, 0x0C, 0x00, /* 0x54 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, /* 0x55 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x1C, 0xE0, 0x00, 0xE0, 0x1C, 0x00, /* 0x56 */
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x3C, 0xC0, 0x30, 0xC0, 0x3C, 0x00, /* 0x57 */
+	0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x04, 0xD8, 0x20, 0xD8, 0x04, 0x00, /* 0x58 */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x04, 0x18, 0xE0, 0x18, 0x04, 0x00, /* 0x59 */
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x84, 0x44, 0x24, 0x14, 0x0C, 0x00, /* 0x5A */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0xFC, 0x04, 0x04, 0x04, 0x00, 0x00, /* 0x5B */
+	0x00, 0x07, 0x04, 0x04, 0x04, 0x00, 0x00,
+	0x00, 0x0C, 0x30, 0xC0, 0x00, 0x00, 0x00, /* 0x5C */
+	0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+	0x00, 0x04, 0x04, 0x04, 0xFC, 0x00, 0x00, /* 0x5D */
+	0x00, 0x04, 0x04, 0x04, 0x07, 0x00, 0x00,
+	0x00, 0x20, 0x18, 0x04, 0x18, 0x20, 0x00, /* 0x5E */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x5F */
+	0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00,
+	0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, /* 0x60 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x90, 0x50, 0x50, 0xE0, 0x00, 0x00, /* 0x61 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x04, 0xFC, 0x10, 0x10, 0xE0, 0x00, 0x00, /* 0x62 */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x10, 0x10, 0x30, 0x00, 0x00, /* 0x63 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xE0, 0x10, 0x14, 0xFC, 0x00, 0x00, /* 0x64 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0xE0, 0x50, 0x50, 0x60, 0x00, 0x00, /* 0x65 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x10, 0xF8, 0x14, 0x14, 0x00, 0x00, /* 0x66 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xE0, 0x10, 0x10, 0xF0, 0x00, 0x00, /* 0x67 */
+	0x00, 0x04, 0x05, 0x05, 0x03, 0x00, 0x00,
+	0x04, 0xFC, 0x10, 0x10, 0xE0, 0x00, 0x00, /* 0x68 */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x10, 0x10, 0xF4, 0x00, 0x00, 0x00, /* 0x69 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x10, 0x10, 0xF4, 0x00, 0x00, 0x00, /* 0x6A */
+	0x02, 0x04, 0x04, 0x03, 0x00, 0x00, 0x00,
+	0x04, 0xFC, 0x40, 0xA0, 0x10, 0x00, 0x00, /* 0x6B */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x6C */
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0xF0, 0x10, 0xE0, 0x10, 0xE0, 0x00, 0x00, /* 0x6D */
+	0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+	0x10, 0xF0, 0x10, 0x10, 0xE0, 0x00, 0x00, /* 0x6E */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0xE0, 0x10, 0x10, 0xE0, 0x00, 0x00, /* 0x6F */
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x10, 0xF0, 0x10, 0x10, 0xE0, 0x00, 0x00, /* 0x70 */
+	0x00, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0xE0, 0x10, 0x10, 0x10, 0xF0, 0x00, 0x00, /* 0x71 */
+	0x00, 0x01, 0x01, 0x01, 0x07, 0x00, 0x00,
+	0x00, 0x10, 0xF0, 0x10, 0x10, 0x30, 0x00, /* 0x72 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x20, 0x50, 0x50, 0x90, 0x00, 0x00, /* 0x73 */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x10, 0xF8, 0x10, 0x10, 0x10, 0x00, 0x00, /* 0x74 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x10, 0xF0, 0x00, 0x10, 0xF0, 0x00, 0x00, /* 0x75 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x10, 0xE0, 0x00, 0xE0, 0x10, 0x00, /* 0x76 */
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x70, 0x80, 0x60, 0x80, 0x70, 0x00, 0x00, /* 0x77 */
+	0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x10, 0xA0, 0x40, 0xA0, 0x10, 0x00, 0x00, /* 0x78 */
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x10, 0xE0, 0x00, 0xC0, 0x30, 0x00, 0x00, /* 0x79 */
+	0x00, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x90, 0x50, 0x30, 0x10, 0x00, 0x00, /* 0x7A */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x40, 0xB8, 0x04, 0x04, 0x00, 0x00, /* 0x7B */
+	0x00, 0x00, 0x03, 0x04, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, /* 0x7C */
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x04, 0xB8, 0x40, 0x00, 0x00, /* 0x7D */
+	0x00, 0x04, 0x04, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x40, 0x20, 0x40, 0x20, 0x00, 0x00, /* 0x7E */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x7F */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x04, 0xFC, 0x24, 0x24, 0xC0, 0x00, /* 0x80 */
+	0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x04, 0xFC, 0x05, 0x04, 0x0C, 0x00, /* 0x81 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x82 */
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0xF0, 0x14, 0x32, 0x00, 0x00, /* 0x83 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x84 */
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x85 */
+	0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0xFC, 0x10, 0x00, 0x00, /* 0x86 */
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x50, 0xFC, 0x50, 0x00, 0x00, /* 0x87 */
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x50, 0xF8, 0x54, 0x54, 0x54, 0x00, /* 0x88 */
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x28, 0xB4, 0x68, 0x90, 0x90, 0x50, 0x00, /* 0x89 */
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xFC, 0x04, 0xFC, 0x20, 0xC0, 0x00, /* 0x8A */
+	0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x40, 0xA0, 0x10, 0x00, 0x00, /* 0x8B */
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0xFC, 0x20, 0xFC, 0x20, 0xC0, 0x00, /* 0x8C */
+	0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xFC, 0x20, 0x51, 0x88, 0x04, 0x00, /* 0x8D */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x04, 0x04, 0xFC, 0x24, 0x24, 0xC0, 0x00, /* 0x8E */
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x00, /* 0x8F */
+	0x00, 0x01, 0x01, 0x07, 0x01, 0x01, 0x00,
+	0x10, 0xFC, 0x50, 0x50, 0x80, 0x00, 0x00, /* 0x90 */
+	0x00, 0x01, 0x00, 0x04, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, /* 0x91 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, /* 0x92 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, /* 0x93 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1C, 0x00, 0x1C, 0x00, 0x00, 0x00, /* 0x94 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x70, 0x20, 0x00, 0x00, /* 0x95 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, /* 0x96 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, /* 0x97 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x98 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x3C, 0x04, 0x3C, 0x10, 0x3C, 0x00, /* 0x99 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xF0, 0x10, 0xF0, 0x40, 0x80, 0x00, /* 0x9A */
+	0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x10, 0xA0, 0x40, 0x00, 0x00, 0x00, /* 0x9B */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xF0, 0x40, 0x40, 0xF0, 0x40, 0x80, 0x00, /* 0x9C */
+	0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xF0, 0x44, 0xA2, 0x10, 0x00, 0x00, /* 0x9D */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x10, 0xFC, 0x50, 0x50, 0x80, 0x00, 0x00, /* 0x9E */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, /* 0x9F */
+	0x00, 0x01, 0x01, 0x07, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xA0 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x18, 0x61, 0xC1, 0x38, 0x04, 0x00, /* 0xA1 */
+	0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0xE2, 0x04, 0xC4, 0x32, 0x00, 0x00, /* 0xA2 */
+	0x00, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x04, 0x04, 0xFC, 0x00, 0x00, /* 0xA3 */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x88, 0x70, 0x50, 0x70, 0x88, 0x00, /* 0xA4 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0xFC, 0x04, 0x04, 0x06, 0x00, /* 0xA5 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, /* 0xA6 */
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x28, 0x54, 0x54, 0xA4, 0x00, 0x00, /* 0xA7 */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xFD, 0x24, 0x25, 0x24, 0x00, 0x00, /* 0xA8 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xE0, 0x10, 0x70, 0x10, 0xE0, 0x00, /* 0xA9 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xF8, 0x24, 0x24, 0x8C, 0x00, 0x00, /* 0xAA */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x40, 0xA0, 0x50, 0xA0, 0x10, 0x00, /* 0xAB */
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+	0x00, 0x20, 0x20, 0x20, 0x60, 0x00, 0x00, /* 0xAC */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xAD */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x38, 0x4C, 0x5C, 0x44, 0x38, 0x00, /* 0xAE */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x05, 0xFC, 0x05, 0x04, 0x00, /* 0xAF */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x08, 0x14, 0x08, 0x00, 0x00, /* 0xB0 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x90, 0x90, 0xBC, 0x90, 0x90, 0x00, /* 0xB1 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x04, 0xFC, 0x04, 0x04, 0x00, /* 0xB2 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x10, 0x10, 0xF4, 0x00, 0x00, 0x00, /* 0xB3 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x10, 0xF0, 0x10, 0x18, 0x00, 0x00, /* 0xB4 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, /* 0xB5 */
+	0x00, 0x07, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x38, 0xFC, 0x00, 0xFC, 0x00, 0x00, /* 0xB6 */
+	0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, /* 0xB7 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x54, 0x50, 0x64, 0x00, 0x00, /* 0xB8 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xFC, 0x20, 0xFC, 0x48, 0x54, 0x00, /* 0xB9 */
+	0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x50, 0x50, 0x30, 0x00, 0x00, /* 0xBA */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x10, 0xA0, 0x50, 0xA0, 0x40, 0x00, /* 0xBB */
+	0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x10, 0xF4, 0x00, 0x00, 0x00, /* 0xBC */
+	0x02, 0x04, 0x04, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x98, 0x24, 0x24, 0x24, 0xCC, 0x00, /* 0xBD */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x20, 0x50, 0x50, 0x90, 0x00, 0x00, /* 0xBE */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x14, 0xF0, 0x04, 0x00, 0x00, /* 0xBF */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x80, 0x70, 0x4C, 0x70, 0x80, 0x00, /* 0xC0 */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xFC, 0x24, 0x24, 0xC4, 0x00, 0x00, /* 0xC1 */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xFC, 0x24, 0x24, 0x24, 0xD8, 0x00, /* 0xC2 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x04, 0xFC, 0x04, 0x04, 0x0C, 0x00, /* 0xC3 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x80, 0x7C, 0x04, 0xFC, 0x00, 0x00, /* 0xC4 */
+	0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00,
+	0x00, 0xFC, 0x24, 0x24, 0x24, 0x00, 0x00, /* 0xC5 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xDC, 0x20, 0xFC, 0x20, 0xDC, 0x00, /* 0xC6 */
+	0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+	0x00, 0x8C, 0x04, 0x24, 0x24, 0xD8, 0x00, /* 0xC7 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xFC, 0x40, 0x30, 0x08, 0xFC, 0x00, /* 0xC8 */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xFC, 0x41, 0x31, 0x08, 0xFC, 0x00, /* 0xC9 */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xFC, 0x20, 0x50, 0x88, 0x04, 0x00, /* 0xCA */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x80, 0x7C, 0x04, 0xFC, 0x00, 0x00, /* 0xCB */
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0xFC, 0x08, 0x30, 0x08, 0xFC, 0x00, /* 0xCC */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xFC, 0x20, 0x20, 0x20, 0xFC, 0x00, /* 0xCD */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xF8, 0x04, 0x04, 0x04, 0xF8, 0x00, /* 0xCE */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xFC, 0x04, 0x04, 0x04, 0xFC, 0x00, /* 0xCF */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xFC, 0x24, 0x24, 0x18, 0x00, 0x00, /* 0xD0 */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xF8, 0x04, 0x04, 0x04, 0x8C, 0x00, /* 0xD1 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x0C, 0x04, 0xFC, 0x04, 0x0C, 0x00, /* 0xD2 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x04, 0x18, 0x60, 0xC0, 0x38, 0x04, 0x00, /* 0xD3 */
+	0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x88, 0xFC, 0x88, 0x70, 0x00, /* 0xD4 */
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0xD8, 0x20, 0xD8, 0x04, 0x00, /* 0xD5 */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, /* 0xD6 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00,
+	0x00, 0x3C, 0x40, 0x40, 0x40, 0xFC, 0x00, /* 0xD7 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, /* 0xD8 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFC, 0x00, /* 0xD9 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x04, 0xFC, 0x10, 0x10, 0xE0, 0x00, /* 0xDA */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xFC, 0x10, 0xE0, 0x00, 0xFC, 0x00, /* 0xDB */
+	0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xFC, 0x10, 0x10, 0xE0, 0x00, 0x00, /* 0xDC */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x8C, 0x04, 0x24, 0x24, 0xF8, 0x00, /* 0xDD */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xFC, 0x20, 0xF8, 0x04, 0xF8, 0x00, /* 0xDE */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x18, 0xE4, 0x24, 0xFC, 0x00, 0x00, /* 0xDF */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x90, 0x50, 0x50, 0xE0, 0x00, 0x00, /* 0xE0 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0xF8, 0x14, 0x14, 0xE4, 0x00, 0x00, /* 0xE1 */
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xF0, 0x50, 0x50, 0xA0, 0x00, 0x00, /* 0xE2 */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0xF0, 0x10, 0x30, 0x00, 0x00, /* 0xE3 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x80, 0x70, 0x10, 0xF0, 0x00, 0x00, /* 0xE4 */
+	0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00,
+	0x00, 0xE0, 0x50, 0x50, 0x60, 0x00, 0x00, /* 0xE5 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0xB0, 0x40, 0xF0, 0x40, 0xB0, 0x00, 0x00, /* 0xE6 */
+	0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x30, 0x10, 0x50, 0xA0, 0x00, 0x00, /* 0xE7 */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xF0, 0x40, 0x20, 0xF0, 0x00, 0x00, /* 0xE8 */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0xF2, 0x44, 0x24, 0xF2, 0x00, 0x00, /* 0xE9 */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0xF0, 0x40, 0xA0, 0x10, 0x00, 0x00, /* 0xEA */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0xF0, 0x10, 0x10, 0xF0, 0x00, 0x00, /* 0xEB */
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0xF0, 0x20, 0xC0, 0x20, 0xF0, 0x00, /* 0xEC */
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xF0, 0x40, 0x40, 0xF0, 0x00, 0x00, /* 0xED */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0xE0, 0x10, 0x10, 0xE0, 0x00, 0x00, /* 0xEE */
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xF0, 0x10, 0x10, 0xF0, 0x00, 0x00, /* 0xEF */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x10, 0xF0, 0x10, 0x10, 0xE0, 0x00, 0x00, /* 0xF0 */
+	0x00, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x10, 0x10, 0x30, 0x00, 0x00, /* 0xF1 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x30, 0x10, 0xF0, 0x10, 0x30, 0x00, 0x00, /* 0xF2 */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x10, 0xE0, 0x00, 0xC0, 0x30, 0x00, 0x00, /* 0xF3 */
+	0x00, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x14, 0xFC, 0x10, 0xE0, 0x00, /* 0xF4 */
+	0x00, 0x00, 0x01, 0x07, 0x01, 0x00, 0x00,
+	0x10, 0xA0, 0x40, 0xA0, 0x10, 0x00, 0x00, /* 0xF5 */
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, /* 0xF6 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00,
+	0x00, 0x30, 0x40, 0x40, 0xF0, 0x00, 0x00, /* 0xF7 */
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, /* 0xF8 */
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x00, /* 0xF9 */
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00,
+	0x10, 0xF0, 0x40, 0x40, 0x80, 0x00, 0x00, /* 0xFA */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xF0, 0x40, 0x80, 0x00, 0xF0, 0x00, /* 0xFB */
+	0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0xF0, 0x40, 0x40, 0x80, 0x00, 0x00, /* 0xFC */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x50, 0x50, 0xE0, 0x00, 0x00, /* 0xFD */
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xF0, 0x40, 0xE0, 0x10, 0xE0, 0x00, /* 0xFE */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x20, 0xD0, 0x50, 0xF0, 0x00, 0x00, /* 0xFF */
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+};
+#endif
+
+#if defined(SSD1306_FONT_USE_PAGE_MAJOR) && defined(SSD1306_INCLUDE_FONT_7x14)
+const uint8_t FONT_7x14_PAGES_ARRAY[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x20 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, /* 0x21 */
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0x00, /* 0x22 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0xA0, 0xE0, 0xB8, 0xE0, 0xB8, 0x20, /* 0x23 */
+	0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x48, 0xFC, 0x88, 0x08, 0x00, /* 0x24 */
+	0x00, 0x04, 0x04, 0x0F, 0x04, 0x03, 0x00,
+	0x30, 0x48, 0x30, 0xC0, 0x30, 0x88, 0x00, /* 0x25 */
+	0x00, 0x04, 0x03, 0x00, 0x03, 0x04, 0x03,
+	0x00, 0x80, 0x70, 0xC8, 0x30, 0x00, 0x80, /* 0x26 */
+	0x03, 0x04, 0x04, 0x04, 0x05, 0x02, 0x05,
+	0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, /* 0x27 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xC0, 0x20, 0x10, 0x08, 0x08, 0x00, /* 0x28 */
+	0x00, 0x07, 0x08, 0x10, 0x20, 0x20, 0x00,
+	0x00, 0x08, 0x08, 0x10, 0x20, 0xC0, 0x00, /* 0x29 */
+	0x00, 0x20, 0x20, 0x10, 0x08, 0x07, 0x00,
+	0x20, 0xA8, 0x70, 0x70, 0xA8, 0x20, 0x00, /* 0x2A */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x40, 0x40, 0x40, 0xF8, 0x40, 0x40, 0x40, /* 0x2B */
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x2C */
+	0x00, 0x00, 0x10, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, /* 0x2D */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x2E */
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x70, 0x08, 0x00, /* 0x2F */
+	0x00, 0x18, 0x06, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xF0, 0x88, 0x48, 0x28, 0xF0, 0x00, /* 0x30 */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0x10, 0x08, 0xF8, 0x00, 0x00, 0x00, /* 0x31 */
+	0x00, 0x04, 0x04, 0x07, 0x04, 0x04, 0x00,
+	0x00, 0x10, 0x08, 0x08, 0x88, 0x70, 0x00, /* 0x32 */
+	0x00, 0x04, 0x06, 0x05, 0x04, 0x04, 0x00,
+	0x00, 0x08, 0x48, 0x68, 0x58, 0x88, 0x00, /* 0x33 */
+	0x00, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x80, 0x40, 0x20, 0x10, 0xF8, 0x00, 0x00, /* 0x34 */
+	0x01, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01,
+	0x00, 0x00, 0x78, 0x48, 0x48, 0x88, 0x00, /* 0x35 */
+	0x00, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0xE0, 0x50, 0x48, 0x48, 0x80, 0x00, /* 0x36 */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0x08, 0x08, 0x88, 0x68, 0x18, 0x00, /* 0x37 */
+	0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0xC8, 0x48, 0xC8, 0x30, 0x00, /* 0x38 */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0x70, 0x88, 0x88, 0x88, 0xF0, 0x00, /* 0x39 */
+	0x00, 0x00, 0x04, 0x04, 0x02, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, /* 0x3A */
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, /* 0x3B */
+	0x00, 0x00, 0x10, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, /* 0x3C */
+	0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x04,
+	0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, /* 0x3D */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x00, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, /* 0x3E */
+	0x00, 0x04, 0x02, 0x02, 0x01, 0x01, 0x00,
+	0x10, 0x08, 0x08, 0x88, 0x48, 0x30, 0x00, /* 0x3F */
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0xC0, 0x20, 0x10, 0x90, 0x90, 0xE0, 0x00, /* 0x40 */
+	0x0F, 0x10, 0x23, 0x24, 0x24, 0x27, 0x14,
+	0x00, 0x80, 0x70, 0x08, 0x70, 0x80, 0x00, /* 0x41 */
+	0x04, 0x03, 0x01, 0x01, 0x01, 0x03, 0x04,
+	0x00, 0xF8, 0x48, 0x48, 0x48, 0xB0, 0x00, /* 0x42 */
+	0x00, 0x07, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0xE0, 0x10, 0x08, 0x08, 0x18, 0x00, /* 0x43 */
+	0x00, 0x01, 0x02, 0x04, 0x04, 0x06, 0x00,
+	0x00, 0xF8, 0x08, 0x08, 0x08, 0x10, 0xE0, /* 0x44 */
+	0x00, 0x07, 0x04, 0x04, 0x04, 0x02, 0x01,
+	0x00, 0xF8, 0x48, 0x48, 0x48, 0x48, 0x00, /* 0x45 */
+	0x00, 0x07, 0x04, 0x04, 0x04, 0x04, 0x00,
+	0x00, 0xF8, 0x48, 0x48, 0x48, 0x48, 0x00, /* 0x46 */
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x10, 0x08, 0x88, 0x98, 0x00, /* 0x47 */
+	0x00, 0x01, 0x02, 0x04, 0x04, 0x07, 0x00,
+	0x00, 0xF8, 0x40, 0x40, 0x40, 0x40, 0xF8, /* 0x48 */
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x00, /* 0x49 */
+	0x00, 0x04, 0x04, 0x07, 0x04, 0x04, 0x00,
+	0x00, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x00, /* 0x4A */
+	0x00, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0xF8, 0x40, 0xA0, 0x10, 0x08, 0x00, /* 0x4B */
+	0x00, 0x07, 0x00, 0x00, 0x01, 0x02, 0x04,
+	0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x4C */
+	0x00, 0x07, 0x04, 0x04, 0x04, 0x07, 0x00,
+	0x00, 0xF8, 0x10, 0xE0, 0x60, 0x10, 0xF8, /* 0x4D */
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0xF8, 0x20, 0xC0, 0x00, 0xF8, 0x00, /* 0x4E */
+	0x00, 0x07, 0x00, 0x00, 0x01, 0x07, 0x00,
+	0x00, 0xE0, 0x10, 0x08, 0x08, 0x10, 0xE0, /* 0x4F */
+	0x00, 0x01, 0x02, 0x04, 0x04, 0x02, 0x01,
+	0x00, 0xF8, 0x88, 0x88, 0x88, 0x70, 0x00, /* 0x50 */
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x10, 0x08, 0x08, 0x10, 0xE0, /* 0x51 */
+	0x00, 0x01, 0x02, 0x0C, 0x14, 0x12, 0x01,
+	0x00, 0xF8, 0x88, 0x88, 0x88, 0x70, 0x00, /* 0x52 */
+	0x00, 0x07, 0x00, 0x00, 0x03, 0x04, 0x00,
+	0x00, 0x30, 0x48, 0x48, 0x88, 0x18, 0x00, /* 0x53 */
+	0x00, 0x06, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0x18, 0x08, 0xF8, 0x08, 0x18, 0x00, /* 0x54 */
+	0x00, 0x00, 0x04, 0x07, 0x04, 0x00, 0x00,
+	0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, /* 0x55 */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x04, 0x03,
+	0x08, 0x70, 0x80, 0x00, 0x80, 0x70, 0x08, /* 0x56 */
+	0x00, 0x00, 0x03, 0x04, 0x03, 0x00, 0x00,
+	0x00, 0xF8, 0x00, 0xC0, 0x00, 0xF8, 0x00, /* 0x57 */
+	0x00, 0x00, 0x07, 0x01, 0x07, 0x00, 0x00,
+	0x00, 0x08, 0x30, 0xC0, 0x30, 0x08, 0x00, /* 0x58 */
+	0x00, 0x04, 0x03, 0x00, 0x03, 0x04, 0x00,
+	0x08, 0x10, 0x60, 0x80, 0x60, 0x10, 0x08, /* 0x59 */
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x08, 0xC8, 0x28, 0x18, 0x00, /* 0x5A */
+	0x00, 0x06, 0x05, 0x04, 0x04, 0x04, 0x00,
+	0x00, 0x00, 0xF8, 0x08, 0x08, 0x08, 0x08, /* 0x5B */
+	0x00, 0x00, 0x3F, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x18, 0x60, 0x80, 0x00, 0x00, 0x00, /* 0x5C */
+	0x00, 0x00, 0x00, 0x01, 0x0E, 0x10, 0x00,
+	0x00, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x00, /* 0x5D */
+	0x00, 0x20, 0x20, 0x20, 0x20, 0x3F, 0x00,
+	0x80, 0x40, 0x30, 0x08, 0x30, 0x40, 0x80, /* 0x5E */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x5F */
+	0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, /* 0x60 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0xA0, 0xA0, 0xA0, 0xC0, 0x00, /* 0x61 */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x07, 0x04,
+	0x08, 0xF8, 0x20, 0x20, 0x20, 0xC0, 0x00, /* 0x62 */
+	0x00, 0x07, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0xC0, 0x20, 0x20, 0x20, 0x60, 0x00, /* 0x63 */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x02, 0x00,
+	0x00, 0xC0, 0x20, 0x20, 0x28, 0xF8, 0x00, /* 0x64 */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x07, 0x04,
+	0x00, 0xC0, 0xA0, 0xA0, 0xA0, 0xC0, 0x00, /* 0x65 */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x02, 0x00,
+	0x00, 0x20, 0xF0, 0x28, 0x28, 0x08, 0x00, /* 0x66 */
+	0x00, 0x04, 0x07, 0x04, 0x04, 0x00, 0x00,
+	0x00, 0xC0, 0x20, 0x20, 0x20, 0xE0, 0x00, /* 0x67 */
+	0x00, 0x23, 0x24, 0x24, 0x24, 0x1F, 0x00,
+	0x08, 0xF8, 0x40, 0x20, 0x20, 0xC0, 0x00, /* 0x68 */
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0x20, 0x20, 0xEC, 0x00, 0x00, 0x00, /* 0x69 */
+	0x00, 0x04, 0x04, 0x07, 0x04, 0x04, 0x00,
+	0x00, 0x20, 0x20, 0x20, 0xEC, 0x00, 0x00, /* 0x6A */
+	0x00, 0x10, 0x20, 0x20, 0x1F, 0x00, 0x00,
+	0x08, 0xF8, 0x80, 0x40, 0x20, 0x00, 0x00, /* 0x6B */
+	0x00, 0x07, 0x00, 0x01, 0x02, 0x04, 0x00,
+	0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, /* 0x6C */
+	0x00, 0x00, 0x03, 0x04, 0x04, 0x02, 0x00,
+	0xE0, 0x20, 0x20, 0xC0, 0x20, 0x20, 0xC0, /* 0x6D */
+	0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07,
+	0x20, 0xE0, 0x40, 0x20, 0x20, 0xC0, 0x00, /* 0x6E */
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0xC0, 0x20, 0x20, 0x20, 0xC0, 0x00, /* 0x6F */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x20, 0xE0, 0x20, 0x20, 0x20, 0xC0, 0x00, /* 0x70 */
+	0x00, 0x3F, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0xC0, 0x20, 0x20, 0x20, 0xE0, 0x00, /* 0x71 */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x3F, 0x00,
+	0x20, 0x20, 0xE0, 0x40, 0x20, 0x60, 0x00, /* 0x72 */
+	0x04, 0x04, 0x07, 0x04, 0x04, 0x00, 0x00,
+	0x00, 0x40, 0xA0, 0xA0, 0x20, 0x40, 0x00, /* 0x73 */
+	0x00, 0x02, 0x04, 0x04, 0x05, 0x02, 0x00,
+	0x00, 0x20, 0xF0, 0x20, 0x20, 0x20, 0x00, /* 0x74 */
+	0x00, 0x00, 0x03, 0x04, 0x04, 0x04, 0x02,
+	0x20, 0xE0, 0x00, 0x00, 0x20, 0xE0, 0x00, /* 0x75 */
+	0x00, 0x03, 0x04, 0x04, 0x02, 0x07, 0x04,
+	0x00, 0x60, 0x80, 0x00, 0x80, 0x60, 0x00, /* 0x76 */
+	0x00, 0x00, 0x03, 0x04, 0x03, 0x00, 0x00,
+	0xE0, 0x00, 0x80, 0x40, 0x80, 0x00, 0xE0, /* 0x77 */
+	0x01, 0x06, 0x01, 0x00, 0x01, 0x06, 0x01,
+	0x00, 0x20, 0x40, 0x80, 0x40, 0x20, 0x00, /* 0x78 */
+	0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00,
+	0x20, 0xC0, 0x00, 0x00, 0x80, 0x60, 0x00, /* 0x79 */
+	0x00, 0x21, 0x26, 0x1C, 0x03, 0x00, 0x00,
+	0x00, 0x20, 0x20, 0xA0, 0x60, 0x20, 0x00, /* 0x7A */
+	0x00, 0x06, 0x05, 0x04, 0x04, 0x04, 0x00,
+	0x00, 0x00, 0x80, 0x70, 0x08, 0x08, 0x00, /* 0x7B */
+	0x00, 0x01, 0x02, 0x1C, 0x20, 0x20, 0x00,
+	0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, /* 0x7C */
+	0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x08, 0x70, 0x80, 0x00, 0x00, /* 0x7D */
+	0x00, 0x20, 0x20, 0x1C, 0x02, 0x01, 0x00,
+	0x00, 0x80, 0x40, 0x40, 0x80, 0x40, 0x00, /* 0x7E */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x7F */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x08, 0xF8, 0x48, 0x48, 0x40, 0x80, /* 0x80 */
+	0x00, 0x00, 0x07, 0x00, 0x04, 0x04, 0x03,
+	0x00, 0x08, 0xF8, 0x08, 0x0A, 0x09, 0x18, /* 0x81 */
+	0x00, 0x04, 0x07, 0x04, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x82 */
+	0x00, 0x00, 0x10, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0xE0, 0x28, 0x24, 0x60, 0x00, /* 0x83 */
+	0x00, 0x04, 0x07, 0x04, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x84 */
+	0x00, 0x10, 0x0C, 0x10, 0x0C, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x85 */
+	0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
+	0x00, 0x20, 0x20, 0xF8, 0x20, 0x20, 0x00, /* 0x86 */
+	0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x20, 0xF8, 0x20, 0x20, 0x00, /* 0x87 */
+	0x00, 0x01, 0x01, 0x3F, 0x01, 0x01, 0x00,
+	0x00, 0x40, 0xE0, 0x50, 0x48, 0x48, 0x48, /* 0x88 */
+	0x00, 0x01, 0x03, 0x05, 0x05, 0x05, 0x04,
+	0x90, 0xA8, 0x50, 0x40, 0x40, 0x20, 0x00, /* 0x89 */
+	0x00, 0x02, 0x05, 0x02, 0x02, 0x05, 0x02,
+	0x00, 0xF8, 0x08, 0x08, 0xF8, 0x40, 0x80, /* 0x8A */
+	0x04, 0x03, 0x00, 0x00, 0x07, 0x04, 0x03,
+	0x00, 0x00, 0x80, 0x40, 0x20, 0x00, 0x00, /* 0x8B */
+	0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+	0x00, 0xF8, 0x40, 0x40, 0xF8, 0x40, 0x80, /* 0x8C */
+	0x00, 0x07, 0x00, 0x00, 0x07, 0x04, 0x03,
+	0x00, 0xF8, 0x40, 0xA2, 0x11, 0x08, 0x00, /* 0x8D */
+	0x00, 0x07, 0x00, 0x00, 0x01, 0x02, 0x04,
+	0x08, 0x08, 0xF8, 0x48, 0x48, 0x40, 0x80, /* 0x8E */
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, /* 0x8F */
+	0x00, 0x07, 0x04, 0x1C, 0x04, 0x04, 0x07,
+	0x20, 0xF8, 0x20, 0xA0, 0x80, 0x00, 0x00, /* 0x90 */
+	0x00, 0x07, 0x01, 0x00, 0x20, 0x1F, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x04, 0x00, 0x00, /* 0x91 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x0C, 0x00, 0x00, 0x00, /* 0x92 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x04, 0x18, 0x04, 0x00, /* 0x93 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x0C, 0x10, 0x0C, 0x00, 0x00, /* 0x94 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0xC0, 0x80, 0x00, 0x00, /* 0x95 */
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, /* 0x96 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, /* 0x97 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x98 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x78, 0x08, 0x78, 0x30, 0x10, 0x78, /* 0x99 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x20, 0xE0, 0x80, 0x80, 0x00, /* 0x9A */
+	0x04, 0x03, 0x00, 0x07, 0x04, 0x04, 0x03,
+	0x00, 0x00, 0x20, 0x40, 0x80, 0x00, 0x00, /* 0x9B */
+	0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00,
+	0xE0, 0x80, 0x80, 0xE0, 0x80, 0x80, 0x00, /* 0x9C */
+	0x07, 0x00, 0x00, 0x07, 0x04, 0x04, 0x03,
+	0x00, 0xE0, 0x80, 0x48, 0x24, 0x00, 0x00, /* 0x9D */
+	0x00, 0x07, 0x00, 0x01, 0x02, 0x04, 0x00,
+	0x20, 0xF8, 0x20, 0xA0, 0x80, 0x00, 0x00, /* 0x9E */
+	0x00, 0x07, 0x01, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, /* 0x9F */
+	0x00, 0x07, 0x04, 0x1C, 0x04, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xA0 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xF0, 0x08, 0x04, 0x04, 0x08, 0xF0, /* 0xA1 */
+	0x00, 0x04, 0x07, 0x00, 0x00, 0x07, 0x04,
+	0x20, 0xC4, 0x08, 0x08, 0x84, 0x60, 0x00, /* 0xA2 */
+	0x00, 0x21, 0x26, 0x1C, 0x03, 0x00, 0x00,
+	0x00, 0x08, 0x08, 0x08, 0x08, 0xF8, 0x00, /* 0xA3 */
+	0x00, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0x10, 0xE0, 0x20, 0x20, 0xE0, 0x10, /* 0xA4 */
+	0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02,
+	0x00, 0x08, 0xF8, 0x08, 0x08, 0x08, 0x0C, /* 0xA5 */
+	0x00, 0x04, 0x07, 0x04, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, /* 0xA6 */
+	0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
+	0x00, 0xD0, 0x28, 0x28, 0x28, 0xC8, 0x00, /* 0xA7 */
+	0x00, 0x04, 0x05, 0x05, 0x05, 0x02, 0x00,
+	0x00, 0xF8, 0x4A, 0x48, 0x4A, 0x48, 0x00, /* 0xA8 */
+	0x00, 0x07, 0x04, 0x04, 0x04, 0x04, 0x00,
+	0x00, 0x80, 0x40, 0xA0, 0xA0, 0x40, 0x80, /* 0xA9 */
+	0x00, 0x01, 0x02, 0x05, 0x05, 0x02, 0x01,
+	0x00, 0xE0, 0x50, 0x48, 0x48, 0x48, 0x18, /* 0xAA */
+	0x00, 0x01, 0x02, 0x04, 0x04, 0x04, 0x06,
+	0x00, 0x80, 0x40, 0x20, 0x80, 0x40, 0x20, /* 0xAB */
+	0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x02,
+	0x00, 0x40, 0x40, 0x40, 0x40, 0xC0, 0x00, /* 0xAC */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xAD */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x60, 0x90, 0x68, 0x68, 0x90, 0x60, /* 0xAE */
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x08, 0x0A, 0xF8, 0x0A, 0x08, 0x00, /* 0xAF */
+	0x00, 0x04, 0x04, 0x07, 0x04, 0x04, 0x00,
+	0x00, 0x00, 0x10, 0x28, 0x10, 0x00, 0x00, /* 0xB0 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x20, 0x78, 0x20, 0x20, 0x00, /* 0xB1 */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x08, 0x08, 0xF8, 0x08, 0x08, 0x00, /* 0xB2 */
+	0x00, 0x04, 0x04, 0x07, 0x04, 0x04, 0x00,
+	0x00, 0x20, 0x20, 0xEC, 0x00, 0x00, 0x00, /* 0xB3 */
+	0x00, 0x04, 0x04, 0x07, 0x04, 0x04, 0x00,
+	0x00, 0x20, 0xE0, 0x20, 0x20, 0x30, 0x00, /* 0xB4 */
+	0x00, 0x04, 0x07, 0x04, 0x04, 0x00, 0x00,
+	0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, /* 0xB5 */
+	0x00, 0x3F, 0x04, 0x04, 0x04, 0x07, 0x04,
+	0x00, 0x70, 0xF8, 0xF8, 0x00, 0xF8, 0x00, /* 0xB6 */
+	0x00, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, /* 0xB7 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xC0, 0xAC, 0xA0, 0xAC, 0xC0, 0x00, /* 0xB8 */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x02, 0x00,
+	0x00, 0xF8, 0xC0, 0xF8, 0x30, 0x48, 0x30, /* 0xB9 */
+	0x00, 0x07, 0x00, 0x07, 0x01, 0x01, 0x01,
+	0x00, 0xC0, 0xA0, 0xA0, 0x20, 0x60, 0x00, /* 0xBA */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x02, 0x00,
+	0x00, 0x20, 0x40, 0x80, 0x20, 0x40, 0x80, /* 0xBB */
+	0x00, 0x02, 0x01, 0x00, 0x02, 0x01, 0x00,
+	0x00, 0x20, 0x20, 0x20, 0xEC, 0x00, 0x00, /* 0xBC */
+	0x00, 0x10, 0x20, 0x20, 0x1F, 0x00, 0x00,
+	0x00, 0x30, 0x48, 0x48, 0x88, 0x18, 0x00, /* 0xBD */
+	0x00, 0x06, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0x40, 0xA0, 0xA0, 0x20, 0x40, 0x00, /* 0xBE */
+	0x00, 0x02, 0x04, 0x04, 0x05, 0x02, 0x00,
+	0x00, 0x20, 0x2C, 0xE0, 0x0C, 0x00, 0x00, /* 0xBF */
+	0x00, 0x04, 0x04, 0x07, 0x04, 0x04, 0x00,
+	0x00, 0x80, 0x70, 0x08, 0x70, 0x80, 0x00, /* 0xC0 */
+	0x04, 0x03, 0x01, 0x01, 0x01, 0x03, 0x04,
+	0x00, 0xF8, 0x48, 0x48, 0x48, 0x80, 0x00, /* 0xC1 */
+	0x00, 0x07, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0xF8, 0x48, 0x48, 0x48, 0xB0, 0x00, /* 0xC2 */
+	0x00, 0x07, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0x08, 0xF8, 0x08, 0x08, 0x08, 0x18, /* 0xC3 */
+	0x00, 0x04, 0x07, 0x04, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0xF8, 0x08, 0x08, 0xF8, 0x00, /* 0xC4 */
+	0x1C, 0x07, 0x04, 0x04, 0x04, 0x07, 0x1C,
+	0x00, 0xF8, 0x48, 0x48, 0x48, 0x48, 0x00, /* 0xC5 */
+	0x00, 0x07, 0x04, 0x04, 0x04, 0x04, 0x00,
+	0x08, 0xB0, 0x40, 0xF8, 0x40, 0xB0, 0x08, /* 0xC6 */
+	0x04, 0x03, 0x00, 0x07, 0x00, 0x03, 0x04,
+	0x00, 0x18, 0x08, 0x48, 0x48, 0xB0, 0x00, /* 0xC7 */
+	0x00, 0x06, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0xF8, 0x00, 0x80, 0x60, 0x10, 0xF8, /* 0xC8 */
+	0x00, 0x07, 0x02, 0x01, 0x00, 0x00, 0x07,
+	0x00, 0xF8, 0x01, 0x82, 0x62, 0x11, 0xF8, /* 0xC9 */
+	0x00, 0x07, 0x02, 0x01, 0x00, 0x00, 0x07,
+	0x00, 0xF8, 0x40, 0xA0, 0x10, 0x08, 0x00, /* 0xCA */
+	0x00, 0x07, 0x00, 0x00, 0x01, 0x02, 0x04,
+	0x00, 0x00, 0x00, 0xF8, 0x08, 0x08, 0xF8, /* 0xCB */
+	0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0xF8, 0x10, 0xE0, 0x60, 0x10, 0xF8, /* 0xCC */
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0xF8, 0x40, 0x40, 0x40, 0x40, 0xF8, /* 0xCD */
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0xE0, 0x10, 0x08, 0x08, 0x10, 0xE0, /* 0xCE */
+	0x00, 0x01, 0x02, 0x04, 0x04, 0x02, 0x01,
+	0x00, 0xF8, 0x08, 0x08, 0x08, 0x08, 0xF8, /* 0xCF */
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0xF8, 0x88, 0x88, 0x88, 0x70, 0x00, /* 0xD0 */
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x10, 0x08, 0x08, 0x18, 0x00, /* 0xD1 */
+	0x00, 0x01, 0x02, 0x04, 0x04, 0x06, 0x00,
+	0x00, 0x18, 0x08, 0xF8, 0x08, 0x18, 0x00, /* 0xD2 */
+	0x00, 0x00, 0x04, 0x07, 0x04, 0x00, 0x00,
+	0x00, 0x08, 0x70, 0x80, 0x00, 0xE0, 0x18, /* 0xD3 */
+	0x00, 0x00, 0x04, 0x05, 0x03, 0x00, 0x00,
+	0x00, 0xE0, 0x10, 0xF8, 0x10, 0xE0, 0x00, /* 0xD4 */
+	0x00, 0x01, 0x02, 0x07, 0x02, 0x01, 0x00,
+	0x00, 0x08, 0x30, 0xC0, 0x30, 0x08, 0x00, /* 0xD5 */
+	0x00, 0x04, 0x03, 0x00, 0x03, 0x04, 0x00,
+	0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0x00, /* 0xD6 */
+	0x00, 0x07, 0x04, 0x04, 0x04, 0x07, 0x1C,
+	0x00, 0x78, 0x80, 0x80, 0x80, 0x80, 0xF8, /* 0xD7 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, /* 0xD8 */
+	0x00, 0x07, 0x04, 0x07, 0x04, 0x07, 0x00,
+	0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, /* 0xD9 */
+	0x00, 0x07, 0x04, 0x07, 0x04, 0x07, 0x1C,
+	0x08, 0x08, 0xF8, 0x40, 0x40, 0x40, 0x80, /* 0xDA */
+	0x00, 0x00, 0x07, 0x04, 0x04, 0x04, 0x03,
+	0x00, 0xF8, 0x40, 0x40, 0x80, 0x00, 0xF8, /* 0xDB */
+	0x00, 0x07, 0x04, 0x04, 0x03, 0x00, 0x07,
+	0x00, 0x00, 0xF8, 0x40, 0x40, 0x40, 0x80, /* 0xDC */
+	0x00, 0x00, 0x07, 0x04, 0x04, 0x04, 0x03,
+	0x00, 0x18, 0x08, 0x48, 0x48, 0x50, 0xE0, /* 0xDD */
+	0x00, 0x06, 0x04, 0x04, 0x04, 0x02, 0x01,
+	0x00, 0xF8, 0x40, 0xF0, 0x08, 0x08, 0xF0, /* 0xDE */
+	0x00, 0x07, 0x00, 0x03, 0x04, 0x04, 0x03,
+	0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0xF8, /* 0xDF */
+	0x00, 0x04, 0x02, 0x01, 0x00, 0x00, 0x07,
+	0x00, 0x20, 0xA0, 0xA0, 0xA0, 0xC0, 0x00, /* 0xE0 */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x07, 0x04,
+	0x00, 0xF0, 0x28, 0x28, 0x24, 0xC4, 0x00, /* 0xE1 */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0xE0, 0xA0, 0xA0, 0xA0, 0x40, 0x00, /* 0xE2 */
+	0x00, 0x07, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0x20, 0xE0, 0x20, 0x20, 0x60, 0x00, /* 0xE3 */
+	0x00, 0x04, 0x07, 0x04, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0x20, 0x20, 0xE0, 0x00, /* 0xE4 */
+	0x0C, 0x06, 0x05, 0x04, 0x04, 0x07, 0x0C,
+	0x00, 0xC0, 0xA0, 0xA0, 0xA0, 0xC0, 0x00, /* 0xE5 */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x02, 0x00,
+	0x20, 0x40, 0x80, 0xE0, 0x80, 0x40, 0x20, /* 0xE6 */
+	0x04, 0x03, 0x00, 0x07, 0x00, 0x03, 0x04,
+	0x00, 0x60, 0x20, 0xA0, 0xA0, 0x40, 0x00, /* 0xE7 */
+	0x00, 0x02, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0xE0, 0x00, 0x80, 0x40, 0xE0, 0x00, /* 0xE8 */
+	0x00, 0x07, 0x02, 0x01, 0x00, 0x07, 0x00,
+	0x00, 0xE0, 0x04, 0x88, 0x48, 0xE4, 0x00, /* 0xE9 */
+	0x00, 0x07, 0x02, 0x01, 0x00, 0x07, 0x00,
+	0x00, 0xE0, 0x80, 0x40, 0x20, 0x00, 0x00, /* 0xEA */
+	0x00, 0x07, 0x00, 0x01, 0x02, 0x04, 0x00,
+	0x00, 0x00, 0xE0, 0x20, 0x20, 0xE0, 0x00, /* 0xEB */
+	0x04, 0x04, 0x03, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0xE0, 0x40, 0x80, 0x40, 0xE0, 0x00, /* 0xEC */
+	0x00, 0x07, 0x00, 0x01, 0x00, 0x07, 0x00,
+	0x00, 0xE0, 0x80, 0x80, 0x80, 0xE0, 0x00, /* 0xED */
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0xC0, 0x20, 0x20, 0x20, 0xC0, 0x00, /* 0xEE */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0xE0, 0x20, 0x20, 0x20, 0xE0, 0x00, /* 0xEF */
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0x20, 0xE0, 0x20, 0x20, 0x20, 0xC0, 0x00, /* 0xF0 */
+	0x00, 0x3F, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0xC0, 0x20, 0x20, 0x20, 0x60, 0x00, /* 0xF1 */
+	0x00, 0x03, 0x04, 0x04, 0x04, 0x02, 0x00,
+	0x00, 0x60, 0x20, 0xE0, 0x20, 0x60, 0x00, /* 0xF2 */
+	0x00, 0x00, 0x04, 0x07, 0x04, 0x00, 0x00,
+	0x20, 0xC0, 0x00, 0x00, 0x80, 0x60, 0x00, /* 0xF3 */
+	0x00, 0x21, 0x26, 0x1C, 0x03, 0x00, 0x00,
+	0xC0, 0x20, 0x28, 0xF8, 0x20, 0x20, 0xC0, /* 0xF4 */
+	0x03, 0x04, 0x04, 0x3F, 0x04, 0x04, 0x03,
+	0x00, 0x20, 0x40, 0x80, 0x40, 0x20, 0x00, /* 0xF5 */
+	0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00,
+	0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, /* 0xF6 */
+	0x00, 0x07, 0x04, 0x04, 0x04, 0x07, 0x0C,
+	0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, /* 0xF7 */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x07, 0x00,
+	0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, /* 0xF8 */
+	0x00, 0x07, 0x04, 0x07, 0x04, 0x07, 0x00,
+	0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, /* 0xF9 */
+	0x00, 0x07, 0x04, 0x07, 0x04, 0x07, 0x0C,
+	0x00, 0x20, 0xE0, 0x80, 0x80, 0x80, 0x00, /* 0xFA */
+	0x00, 0x00, 0x07, 0x04, 0x04, 0x04, 0x03,
+	0x00, 0xE0, 0x80, 0x80, 0x00, 0x00, 0xE0, /* 0xFB */
+	0x00, 0x07, 0x04, 0x04, 0x03, 0x00, 0x07,
+	0x00, 0xE0, 0x80, 0x80, 0x80, 0x00, 0x00, /* 0xFC */
+	0x00, 0x07, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0x20, 0x20, 0xA0, 0xA0, 0xC0, 0x00, /* 0xFD */
+	0x00, 0x04, 0x04, 0x04, 0x04, 0x03, 0x00,
+	0x00, 0xE0, 0x80, 0xC0, 0x20, 0x20, 0xC0, /* 0xFE */
+	0x00, 0x07, 0x00, 0x03, 0x04, 0x04, 0x03,
+	0x00, 0xC0, 0x20, 0x20, 0x20, 0xE0, 0x00, /* 0xFF */
+	0x00, 0x04, 0x03, 0x01, 0x01, 0x07, 0x00,
+};
+#endif
+
+#if defined(SSD1306_FONT_USE_PAGE_MAJOR) && defined(SSD1306_INCLUDE_FONT_11x21)
+const uint8_t FONT_11x21_PAGES_ARRAY[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x20 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, /* 0x21 */
+	0x00, 0x00, 0x00, 0x00, 0xDF, 0xDF, 0xDF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xF8, 0xF8, 0x38, 0x00, 0xF8, 0xF8, 0x38, 0x00, /* 0x22 */
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0xE0, 0xF0, 0x90, 0x80, 0xE0, 0xF0, 0x90, 0x00, /* 0x23 */
+	0x18, 0xD9, 0xFF, 0x3F, 0x19, 0xD9, 0xFF, 0x3F, 0x19, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xF0, 0xF8, 0x98, 0x1E, 0xFE, 0x18, 0x38, 0x00, 0x00, /* 0x24 */
+	0x00, 0x81, 0xC3, 0x83, 0x87, 0xFF, 0x8F, 0xFE, 0xFC, 0x78, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x01, 0x00, 0x00, 0x00,
+	0xF0, 0xF8, 0x98, 0x98, 0xF8, 0xF0, 0x80, 0xC0, 0x60, 0x38, 0x10, /* 0x25 */
+	0x80, 0xC1, 0x61, 0x39, 0x1D, 0xF6, 0xFB, 0x99, 0x98, 0xF8, 0xF0,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x70, 0xF8, 0x98, 0x18, 0x98, 0xF8, 0x70, 0x00, 0x00, 0x00, /* 0x26 */
+	0x78, 0xFC, 0xFE, 0xC7, 0x87, 0x8F, 0xDC, 0xF8, 0x70, 0xFE, 0xCE,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x38, 0x00, 0x00, 0x00, /* 0x27 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xC0, 0xE0, 0xF0, 0x70, 0x38, 0x18, 0x00, 0x00, 0x00, /* 0x28 */
+	0x00, 0xFE, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x07, 0x0F, 0x0E, 0x1C, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x38, 0x70, 0xF0, 0xE0, 0xC0, 0x00, 0x00, /* 0x29 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFE, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x1C, 0x0E, 0x0F, 0x07, 0x03, 0x00, 0x00,
+	0x00, 0x80, 0x90, 0xB8, 0xF0, 0x80, 0xF0, 0xB8, 0x90, 0x80, 0x00, /* 0x2A */
+	0x00, 0x01, 0x05, 0x0D, 0x07, 0x01, 0x07, 0x0D, 0x09, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, /* 0x2B */
+	0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0xFF, 0xFF, 0x0C, 0x0C, 0x0C, 0x0C,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x2C */
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x19, 0x0D, 0x0F, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x2D */
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x2E */
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0x78, 0x10, 0x00, /* 0x2F */
+	0x00, 0x00, 0x00, 0xE0, 0xF8, 0x3E, 0x0F, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x04, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0xE0, 0xF0, 0x78, 0x18, 0x18, 0x18, 0xB8, 0xF0, 0xE0, 0xC0, /* 0x30 */
+	0x1F, 0x7F, 0xFF, 0xF8, 0x8C, 0x86, 0x83, 0xE1, 0xFF, 0x7F, 0x1F,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x40, 0xE0, 0x60, 0x30, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, /* 0x31 */
+	0x00, 0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x30, 0x18, 0x18, 0x18, 0x38, 0xF8, 0xF0, 0xE0, 0x00, /* 0x32 */
+	0x00, 0x00, 0x80, 0xC0, 0xF0, 0xF8, 0x9E, 0x8F, 0x87, 0x81, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0xD8, 0xF8, 0xF8, 0x38, 0x00, 0x00, /* 0x33 */
+	0x00, 0x00, 0xC0, 0x80, 0x87, 0x87, 0xCF, 0xFE, 0xFE, 0x7C, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0x70, 0xF8, 0xF8, 0xF8, 0x00, 0x00, /* 0x34 */
+	0x00, 0x18, 0x1E, 0x1F, 0x19, 0x18, 0xFF, 0xFF, 0xFF, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x00, /* 0x35 */
+	0x00, 0x00, 0xC0, 0x83, 0x83, 0x83, 0xC7, 0xFF, 0xFE, 0x7C, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0xE0, 0xF0, 0x70, 0x38, 0x18, 0x00, 0x00, 0x00, /* 0x36 */
+	0x00, 0x3E, 0xFF, 0xFF, 0xC6, 0x83, 0xC3, 0xFF, 0xFE, 0x7C, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x98, 0xF8, 0xF8, 0x38, 0x00, /* 0x37 */
+	0x00, 0x00, 0x00, 0xC0, 0xF0, 0x7E, 0x0F, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xF0, 0xF8, 0x18, 0x18, 0x18, 0xF8, 0xF0, 0xE0, 0x00, /* 0x38 */
+	0x00, 0x70, 0xF9, 0xFF, 0x8F, 0x86, 0x8F, 0xFF, 0xFD, 0x78, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xF0, 0xF8, 0x38, 0x18, 0x38, 0xF8, 0xF0, 0xE0, 0x00, /* 0x39 */
+	0x00, 0x03, 0x07, 0x8F, 0xCE, 0xCC, 0xF4, 0x7F, 0x3F, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, /* 0x3A */
+	0x00, 0x00, 0x00, 0x00, 0xC3, 0xC3, 0xC3, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, /* 0x3B */
+	0x00, 0x00, 0x00, 0x00, 0xC3, 0xC3, 0xC3, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x19, 0x0D, 0x0F, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x80, /* 0x3C */
+	0x00, 0x08, 0x1C, 0x1C, 0x36, 0x77, 0x63, 0xE3, 0xC1, 0xC1, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x3D */
+	0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x3E */
+	0x00, 0x80, 0xC1, 0xC1, 0xE3, 0x63, 0x77, 0x36, 0x1C, 0x1C, 0x08,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x30, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF0, 0xE0, 0x00, /* 0x3F */
+	0x00, 0x00, 0x00, 0x00, 0xDC, 0xDE, 0xDF, 0x87, 0x03, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, /* 0x40 */
+	0xFC, 0xFF, 0x07, 0xF1, 0xF8, 0x98, 0x98, 0x98, 0xFF, 0xFF, 0x80,
+	0x01, 0x07, 0x0F, 0x0C, 0x1D, 0x19, 0x19, 0x18, 0x1D, 0x19, 0x01,
+	0x00, 0x00, 0x00, 0xE0, 0xF8, 0x78, 0xF8, 0xE0, 0x00, 0x00, 0x00, /* 0x41 */
+	0xC0, 0xF8, 0xFF, 0x3F, 0x33, 0x30, 0x37, 0x3F, 0xFF, 0xF8, 0xC0,
+	0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0xF8, 0xF0, 0xE0, 0x00, /* 0x42 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x86, 0x86, 0xC7, 0xFF, 0xFD, 0x78, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0xE0, 0xF0, 0x70, 0x38, 0x18, 0x18, 0x18, 0xF8, 0xF8, /* 0x43 */
+	0x00, 0x1F, 0x7F, 0xFF, 0xE0, 0xC0, 0x80, 0x80, 0x80, 0xF0, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x38, 0xF0, 0xE0, 0xC0, /* 0x44 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xE0, 0xFF, 0x7F, 0x1F,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, /* 0x45 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x86, 0x86, 0x86, 0x86, 0x86, 0x80, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, /* 0x46 */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0xE0, 0xF0, 0x70, 0x38, 0x18, 0x18, 0x18, 0xF8, 0xF8, /* 0x47 */
+	0x00, 0x1F, 0x7F, 0xFF, 0xE0, 0x80, 0x8C, 0x8C, 0xFC, 0xFC, 0xFC,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, /* 0x48 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x06, 0x06, 0x06, 0x06, 0xFF, 0xFF, 0xFF,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x00, /* 0x49 */
+	0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x00, /* 0x4A */
+	0x00, 0x00, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0xFF, 0xFF, 0x7F, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0xC0, 0xF0, 0x78, 0x38, 0x08, /* 0x4B */
+	0x00, 0xFF, 0xFF, 0xFF, 0x06, 0x0F, 0x3F, 0xF9, 0xE0, 0xC0, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x4C */
+	0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xF0, 0xF0, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0xF8, 0xF8, 0xF8, 0xF0, 0xC0, 0xC0, 0xF0, 0xF8, 0xF8, 0xF8, /* 0x4D */
+	0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0x03, 0x00, 0xFF, 0xFF, 0xFF,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0xF8, 0xF8, 0xF8, 0xE0, 0x80, 0x00, 0xF8, 0xF8, 0xF8, 0x00, /* 0x4E */
+	0x00, 0xFF, 0xFF, 0xFF, 0x03, 0x1F, 0x7C, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0xC0, 0xE0, 0xF0, 0x38, 0x18, 0x18, 0x38, 0xF0, 0xF0, 0xC0, /* 0x4F */
+	0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x80, 0x80, 0xC0, 0xFF, 0x7F, 0x3F,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x38, 0xF8, 0xF0, 0xE0, /* 0x50 */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0C, 0x0C, 0x0E, 0x0F, 0x07, 0x03,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xC0, 0xE0, 0xF0, 0x38, 0x18, 0x18, 0x38, 0xF0, 0xF0, 0xC0, /* 0x51 */
+	0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x80, 0x80, 0xC0, 0xFF, 0x7F, 0x3F,
+	0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0D, 0x0C, 0x0C, 0x0C,
+	0x00, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x38, 0xF8, 0xF0, 0xE0, 0x00, /* 0x52 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x0C, 0x0C, 0x3E, 0xFF, 0xE7, 0xC3, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0xE0, 0xF0, 0xF8, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF0, 0x00, /* 0x53 */
+	0x00, 0xF1, 0xF3, 0x87, 0x87, 0x87, 0x8E, 0xFE, 0xFC, 0x78, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x78, 0x78, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x78, 0x78, /* 0x54 */
+	0x00, 0x00, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, /* 0x55 */
+	0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x80, 0x80, 0xC0, 0xFF, 0xFF, 0x3F,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x18, 0xF8, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xF8, 0x18, /* 0x56 */
+	0x00, 0x00, 0x0F, 0x7F, 0xFE, 0xE0, 0xFC, 0x7F, 0x0F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x80, 0x80, 0x00, 0xF8, 0xF8, 0xF8, /* 0x57 */
+	0x00, 0xFF, 0xFF, 0xF8, 0x3F, 0x07, 0x3F, 0xFC, 0xFF, 0xFF, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x08, 0x18, 0x78, 0xF8, 0xE0, 0x00, 0xC0, 0xF0, 0x78, 0x38, 0x08, /* 0x58 */
+	0x00, 0xC0, 0xF0, 0xF9, 0x3F, 0x0F, 0x3F, 0xF9, 0xF0, 0xC0, 0x00,
+	0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x18, 0x78, 0xF8, 0xF0, 0x80, 0x00, 0x80, 0xE0, 0xF8, 0x78, 0x18, /* 0x59 */
+	0x00, 0x00, 0x01, 0x07, 0xFF, 0xFE, 0xFF, 0x07, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x98, 0xD8, 0xF8, 0x78, 0x38, 0x00, /* 0x5A */
+	0x00, 0xC0, 0xF0, 0xFC, 0xBE, 0x8F, 0x87, 0x81, 0x80, 0x80, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, /* 0x5B */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x10, 0x78, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x5C */
+	0x00, 0x00, 0x00, 0x03, 0x0F, 0x3E, 0xF8, 0xE0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x04, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x00, /* 0x5D */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x1F, 0x1F, 0x00,
+	0x00, 0x00, 0x00, 0xC0, 0xE0, 0x78, 0x38, 0xF0, 0xC0, 0x00, 0x00, /* 0x5E */
+	0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x5F */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x18, 0x38, 0x30, 0x00, 0x00, 0x00, 0x00, /* 0x60 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, /* 0x61 */
+	0x00, 0xF0, 0xFB, 0xF9, 0x99, 0x99, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x18, 0xF8, 0xF8, 0xF8, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, /* 0x62 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0xC3, 0xFF, 0xFF, 0x3E, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, /* 0x63 */
+	0x00, 0x3C, 0xFF, 0xFF, 0xC3, 0x81, 0x81, 0x81, 0xC7, 0x87, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x80, 0x98, 0x98, 0xF8, 0xF8, 0xF8, 0x00, /* 0x64 */
+	0x00, 0x7C, 0xFF, 0xFF, 0xC3, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, /* 0x65 */
+	0x00, 0x3C, 0xFF, 0xFF, 0xDB, 0x99, 0x99, 0x99, 0x9F, 0xDF, 0x9E,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x80, 0x80, 0xE0, 0xF0, 0xF8, 0x98, 0x98, 0xB8, 0x98, /* 0x66 */
+	0x00, 0x00, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, /* 0x67 */
+	0x00, 0x7C, 0xFF, 0xFF, 0xC3, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x0C, 0x19, 0x19, 0x19, 0x1D, 0x1F, 0x0F, 0x07, 0x00,
+	0x18, 0xF8, 0xF8, 0xF8, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, /* 0x68 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x03, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0xB8, 0xB8, 0xB8, 0x00, 0x00, 0x00, 0x00, /* 0x69 */
+	0x00, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x00, 0x80, 0x80, 0x80, 0x80, 0xB8, 0xB8, 0xB8, 0x80, 0x00, 0x00, /* 0x6A */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x0C, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x07, 0x00, 0x00,
+	0x18, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, /* 0x6B */
+	0x00, 0xFF, 0xFF, 0xFF, 0x18, 0x3C, 0x7E, 0xE7, 0xC1, 0x80, 0x80,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x6C */
+	0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, /* 0x6D */
+	0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
+	0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, /* 0x6E */
+	0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x03, 0x01, 0x01, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, /* 0x6F */
+	0x00, 0x3C, 0xFF, 0xFF, 0xC3, 0x81, 0x81, 0xC3, 0xFF, 0xFF, 0x3C,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, /* 0x70 */
+	0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0xC3, 0xFF, 0xFF, 0x7E,
+	0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, /* 0x71 */
+	0x00, 0x7C, 0xFF, 0xFF, 0xC3, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x1F, 0x1F, 0x1F, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, /* 0x72 */
+	0x00, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0x83, 0x81, 0x87, 0x87, 0x07,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, /* 0x73 */
+	0x00, 0x87, 0xCF, 0x9F, 0x9D, 0x99, 0x99, 0xF9, 0xF3, 0xF1, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x80, 0x80, 0xE0, 0xF0, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, /* 0x74 */
+	0x01, 0x01, 0x7F, 0xFF, 0xFF, 0xC1, 0x81, 0x81, 0x81, 0xE1, 0xC0,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, /* 0x75 */
+	0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xC1, 0x7F, 0xFF, 0xFF, 0x80,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, /* 0x76 */
+	0x00, 0x00, 0x07, 0x1F, 0xFE, 0xF0, 0xC0, 0xFC, 0x3F, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, /* 0x77 */
+	0x03, 0x7F, 0xFF, 0xC0, 0xF8, 0x1E, 0xFC, 0xE0, 0xFE, 0x7F, 0x03,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, /* 0x78 */
+	0x00, 0x80, 0xC3, 0xE7, 0x7E, 0x1C, 0x7E, 0xE7, 0xC3, 0x00, 0x00,
+	0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, /* 0x79 */
+	0x00, 0x07, 0x1F, 0xFE, 0xF0, 0x80, 0x80, 0xF8, 0x7F, 0x0F, 0x01,
+	0x00, 0x0C, 0x18, 0x18, 0x19, 0x1F, 0x0F, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, /* 0x7A */
+	0x00, 0xC1, 0xE1, 0xF1, 0xF9, 0xBD, 0x9F, 0x8F, 0x87, 0x83, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x00, /* 0x7B */
+	0x00, 0x18, 0x18, 0x3C, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, /* 0x7C */
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF0, 0x00, 0x00, 0x00, /* 0x7D */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0x3C, 0x18, 0x18,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x1F, 0x1F, 0x0F, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x7E */
+	0x00, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0E, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0x20, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x7F */
+	0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x00, /* 0x80 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0xFF, 0xFE, 0x7C,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0xF8, 0xFA, 0xFB, 0x1B, 0x19, 0x19, 0x78, 0x78, /* 0x81 */
+	0x00, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x82 */
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x0D, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x80, 0xA0, 0xB8, 0x98, 0x88, 0x80, 0x00, /* 0x83 */
+	0x00, 0x81, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x07, 0x07, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x84 */
+	0x00, 0x00, 0xC0, 0xC0, 0x80, 0x00, 0xC0, 0xC0, 0x80, 0x00, 0x00,
+	0x00, 0x08, 0x0D, 0x07, 0x03, 0x08, 0x0D, 0x07, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x85 */
+	0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0,
+	0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+	0x00, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x00, /* 0x86 */
+	0x00, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x00, /* 0x87 */
+	0x00, 0x31, 0x31, 0x31, 0xFF, 0xFF, 0xFF, 0x31, 0x31, 0x31, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0xE0, 0xF0, 0x78, 0x38, 0x18, 0x18, 0x18, 0x18, /* 0x88 */
+	0x12, 0x1B, 0x3F, 0xFF, 0xFF, 0xDB, 0x9B, 0x9B, 0x9B, 0x83, 0xC0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x70, 0xF8, 0x88, 0xF8, 0x70, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0x00, /* 0x89 */
+	0x0C, 0xEC, 0xF6, 0x16, 0xF3, 0xE3, 0xE1, 0xF1, 0x10, 0xF0, 0xE0,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0xF8, 0xF8, 0x18, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, /* 0x8A */
+	0xE0, 0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x7E,
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x8B */
+	0x00, 0x00, 0x00, 0x10, 0x38, 0xEE, 0xC7, 0x82, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0xF8, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, /* 0x8C */
+	0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x7E,
+	0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xF8, 0xF8, 0xF8, 0x02, 0x03, 0xC3, 0xF1, 0x79, 0x38, 0x08, /* 0x8D */
+	0x00, 0xFF, 0xFF, 0xFF, 0x06, 0x0F, 0x3F, 0xF9, 0xE0, 0xC0, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x00, /* 0x8E */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x06, 0x06, 0xFE, 0xFE, 0xFC,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x00, /* 0x8F */
+	0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x0F, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x80, 0xF8, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, /* 0x90 */
+	0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x09, 0x0D, 0xFD, 0xFC, 0xF8, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x18, 0x18, 0x1F, 0x1F, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0xF0, 0xD8, 0x10, 0x00, 0x00, 0x00, /* 0x91 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xB8, 0xF8, 0x70, 0x00, 0x00, 0x00, 0x00, /* 0x92 */
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xF0, 0xD8, 0x10, 0xE0, 0xF0, 0xD8, 0x10, 0x00, /* 0x93 */
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xB8, 0xF8, 0x70, 0x00, 0xB8, 0xF8, 0x70, 0x00, 0x00, /* 0x94 */
+	0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x95 */
+	0x00, 0x00, 0x00, 0x1E, 0x3F, 0x3F, 0x3F, 0x3F, 0x1E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x96 */
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x97 */
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x98 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0xF8, 0xF8, 0x18, 0xF8, 0xF8, 0xF0, 0x70, 0xF8, 0xF8, /* 0x99 */
+	0x00, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, /* 0x9A */
+	0x80, 0xC0, 0xFF, 0x7F, 0x01, 0xFF, 0xFF, 0xFF, 0x8C, 0xFC, 0xFC,
+	0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x9B */
+	0x00, 0x00, 0x00, 0x82, 0xC7, 0xEE, 0x38, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, /* 0x9C */
+	0xFF, 0xFF, 0xFF, 0x18, 0xFF, 0xFF, 0xFF, 0x8C, 0xFC, 0xFC, 0x78,
+	0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x20, 0x38, 0x18, 0x88, 0x80, 0x80, /* 0x9D */
+	0x00, 0xFF, 0xFF, 0xFF, 0x18, 0x1C, 0x7E, 0xF7, 0xC3, 0x81, 0x80,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x80, 0xF8, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, /* 0x9E */
+	0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x09, 0x0D, 0xFD, 0xFC, 0xF8, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, /* 0x9F */
+	0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x0F, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xA0 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, /* 0xA1 */
+	0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x80, 0x80, 0xC0, 0xFF, 0xFF, 0x3F,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x80, 0x80, 0x98, 0x38, 0x30, 0x30, 0x30, 0x38, 0x98, 0x80, 0x80, /* 0xA2 */
+	0x00, 0x07, 0x1F, 0xFE, 0xF0, 0x80, 0x80, 0xF8, 0x7F, 0x0F, 0x01,
+	0x00, 0x0C, 0x18, 0x18, 0x19, 0x1F, 0x0F, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x00, /* 0xA3 */
+	0x00, 0x00, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0xFF, 0xFF, 0x7F, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x40, 0xE0, 0xC0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xE0, 0x40, /* 0xA4 */
+	0x40, 0xE0, 0x7F, 0x3F, 0x31, 0x31, 0x31, 0x3F, 0x7F, 0xE0, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x1F, 0x1F, /* 0xA5 */
+	0x00, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, /* 0xA6 */
+	0x00, 0x00, 0x00, 0x00, 0xF3, 0xF3, 0xF3, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xF0, 0xF8, 0xF8, 0x98, 0x98, 0xB8, 0x00, 0x00, /* 0xA7 */
+	0x00, 0x00, 0x0F, 0xDF, 0x9F, 0x99, 0xF9, 0xFF, 0xFF, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xF8, 0xFB, 0xFB, 0x1B, 0x18, 0x18, 0x1B, 0x1B, 0x1B, 0x00, /* 0xA8 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x86, 0x86, 0x86, 0x86, 0x86, 0x80, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, /* 0xA9 */
+	0x00, 0x3C, 0xC3, 0xBD, 0x7E, 0x42, 0x42, 0x66, 0x81, 0xC3, 0x3C,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0xE0, 0xF0, 0x70, 0x38, 0x18, 0x18, 0x18, 0x78, 0x78, /* 0xAA */
+	0x00, 0x1F, 0x7F, 0xFF, 0xE6, 0xC6, 0x86, 0x86, 0x80, 0xF0, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xAB */
+	0x00, 0x10, 0x38, 0xEE, 0xC7, 0x92, 0x38, 0xEE, 0xC7, 0x82, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xAC */
+	0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x1E, 0x1E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xAD */
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xC0, 0xE0, 0x70, 0xF8, 0x58, 0x58, 0xD8, 0xF8, 0x70, 0xE0, 0xC0, /* 0xAE */
+	0x07, 0x0F, 0x1C, 0x3F, 0x31, 0x33, 0x37, 0x34, 0x18, 0x0F, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x1B, 0x1B, 0xFB, 0xF8, 0xF8, 0x1B, 0x1B, 0x1B, 0x00, /* 0xAF */
+	0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0xF0, 0xF8, 0x98, 0x98, 0xF8, 0xF0, 0x00, 0x00, /* 0xB0 */
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0xF0, 0xF0, 0xF0, 0x80, 0x80, 0x80, 0x00, /* 0xB1 */
+	0x00, 0x31, 0x31, 0x31, 0x37, 0x37, 0x37, 0x31, 0x31, 0x31, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x00, /* 0xB2 */
+	0x00, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0xB8, 0xB8, 0xB8, 0x00, 0x00, 0x00, 0x00, /* 0xB3 */
+	0x00, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xF0, 0xF0, 0x00, /* 0xB4 */
+	0x00, 0x81, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x07, 0x07, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, /* 0xB5 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0xC0, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x1F, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0xE0, 0xF0, 0xF8, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0x00, /* 0xB6 */
+	0x00, 0x00, 0x01, 0x03, 0x07, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xB7 */
+	0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x38, 0x38, 0xB8, 0x80, 0x80, 0xB8, 0xB8, 0x38, 0x00, /* 0xB8 */
+	0x00, 0x3C, 0xFF, 0xFF, 0xDB, 0x99, 0x99, 0x99, 0x9F, 0xDF, 0x9E,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0xF8, 0xF8, 0xF0, 0x80, 0x00, 0xF8, 0xF8, 0xF0, 0xF8, 0xF8, 0xF0, /* 0xB9 */
+	0xFF, 0xFF, 0x07, 0x3F, 0xFC, 0xFF, 0xFF, 0x0C, 0x0D, 0x0D, 0x0C,
+	0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, /* 0xBA */
+	0x00, 0x3C, 0xFF, 0xFF, 0xDB, 0x99, 0x99, 0x81, 0xC7, 0x87, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xBB */
+	0x00, 0x82, 0xC7, 0xEE, 0x38, 0x92, 0xC7, 0xEE, 0x38, 0x10, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x80, 0xB8, 0xB8, 0xB8, 0x80, 0x00, 0x00, /* 0xBC */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x0C, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x07, 0x00, 0x00,
+	0x00, 0xE0, 0xF0, 0xF8, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF0, 0x00, /* 0xBD */
+	0x00, 0xF1, 0xF3, 0x87, 0x87, 0x87, 0x8E, 0xFE, 0xFC, 0x78, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, /* 0xBE */
+	0x00, 0x87, 0xCF, 0x9F, 0x9D, 0x99, 0x99, 0xF9, 0xF3, 0xF1, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0xB8, 0xB8, 0xB8, 0x80, 0x80, 0x38, 0x38, 0x38, 0x00, /* 0xBF */
+	0x00, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0xE0, 0xF8, 0x78, 0xF8, 0xE0, 0x00, 0x00, 0x00, /* 0xC0 */
+	0xC0, 0xF8, 0xFF, 0x3F, 0x33, 0x30, 0x37, 0x3F, 0xFF, 0xF8, 0xC0,
+	0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, /* 0xC1 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0xC7, 0xFF, 0xFE, 0x7C, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0xF8, 0xF0, 0xE0, 0x00, /* 0xC2 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x86, 0x86, 0xC7, 0xFF, 0xFD, 0x78, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x78, 0x78, /* 0xC3 */
+	0x00, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x00, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xF8, 0xF8, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x00, /* 0xC4 */
+	0x80, 0xC0, 0xF8, 0xFF, 0x8F, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x80,
+	0x0F, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x0F,
+	0x00, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, /* 0xC5 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x86, 0x86, 0x86, 0x86, 0x86, 0x80, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x38, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0x38, /* 0xC6 */
+	0xC0, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xC0,
+	0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x70, 0x78, 0x18, 0x18, 0x18, 0x38, 0xF8, 0xF0, 0xE0, 0x00, /* 0xC7 */
+	0x00, 0xF0, 0xF0, 0x80, 0x86, 0x86, 0xCF, 0xFF, 0xFD, 0x78, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0xF8, /* 0xC8 */
+	0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0x07, 0x01, 0xFF, 0xFF, 0xFF,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0xF8, 0xF9, 0xFB, 0x03, 0x03, 0xC3, 0xF3, 0xF9, 0xF8, 0xF8, /* 0xC9 */
+	0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x1E, 0x07, 0x01, 0xFF, 0xFF, 0xFF,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0xC0, 0xF0, 0x78, 0x38, 0x08, /* 0xCA */
+	0x00, 0xFF, 0xFF, 0xFF, 0x06, 0x0F, 0x3F, 0xF9, 0xE0, 0xC0, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x18, 0xF8, 0xF8, 0xF8, 0x00, /* 0xCB */
+	0x80, 0x80, 0xF0, 0xFF, 0x7F, 0x07, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+	0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0xF8, 0xF8, 0xF8, 0xF0, 0xC0, 0xC0, 0xF0, 0xF8, 0xF8, 0xF8, /* 0xCC */
+	0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0x03, 0x00, 0xFF, 0xFF, 0xFF,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, /* 0xCD */
+	0x00, 0xFF, 0xFF, 0xFF, 0x06, 0x06, 0x06, 0x06, 0xFF, 0xFF, 0xFF,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0xC0, 0xE0, 0xF0, 0x38, 0x18, 0x18, 0x38, 0xF0, 0xF0, 0xC0, /* 0xCE */
+	0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x80, 0x80, 0xC0, 0xFF, 0x7F, 0x3F,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x00, /* 0xCF */
+	0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x38, 0xF8, 0xF0, 0xE0, /* 0xD0 */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0C, 0x0C, 0x0E, 0x0F, 0x07, 0x03,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0xE0, 0xF0, 0x70, 0x38, 0x18, 0x18, 0x18, 0xF8, 0xF8, /* 0xD1 */
+	0x00, 0x1F, 0x7F, 0xFF, 0xE0, 0xC0, 0x80, 0x80, 0x80, 0xF0, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x78, 0x78, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x78, 0x78, /* 0xD2 */
+	0x00, 0x00, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x08, 0x78, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x80, 0xF8, 0xF8, 0x18, /* 0xD3 */
+	0x00, 0x00, 0x83, 0x8F, 0x9F, 0xD8, 0xF8, 0x7F, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xC0, 0xE0, 0xF0, 0x30, 0xF8, 0xF8, 0xF8, 0x30, 0xF0, 0xE0, 0xC0, /* 0xD4 */
+	0x1F, 0x3F, 0x7F, 0x60, 0xFF, 0xFF, 0xFF, 0x60, 0x7F, 0x3F, 0x1F,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x18, 0x78, 0xF8, 0xE0, 0x00, 0xC0, 0xF0, 0x78, 0x38, 0x08, /* 0xD5 */
+	0x00, 0xC0, 0xF0, 0xF9, 0x3F, 0x0F, 0x3F, 0xF9, 0xF0, 0xC0, 0x00,
+	0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0x00, /* 0xD6 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x80,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x0F,
+	0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, /* 0xD7 */
+	0x00, 0x03, 0x07, 0x0F, 0x0E, 0x0C, 0x0C, 0x04, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0xF8, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0xF8, /* 0xD8 */
+	0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0xF8, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0xF8, 0x00, 0xF8, 0xF8, 0xF8, /* 0xD9 */
+	0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0F,
+	0x00, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xDA */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0xFF, 0xFE, 0x7C,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, /* 0xDB */
+	0x00, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x7C, 0x00, 0xFF, 0xFF,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
+	0x00, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xDC */
+	0x00, 0xFF, 0xFF, 0xFF, 0x83, 0x83, 0xC7, 0xFF, 0xFE, 0x7C, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0xF0, 0xF8, 0x18, 0x18, 0x18, 0x38, 0x70, 0xF0, 0xE0, 0x80, /* 0xDD */
+	0x00, 0xF0, 0xF0, 0x80, 0x86, 0x86, 0xC6, 0xE6, 0xFF, 0x7F, 0x1F,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xF8, 0xF8, 0xF8, 0x00, 0xE0, 0xF0, 0xF8, 0x18, 0xF8, 0xF0, /* 0xDE */
+	0x00, 0xFF, 0xFF, 0xFF, 0x06, 0x7F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0xE0, 0xF0, 0xF0, 0x38, 0x18, 0x18, 0xF8, 0xF8, 0xF8, /* 0xDF */
+	0x00, 0x00, 0x83, 0xE7, 0xFF, 0x7E, 0x1C, 0x0C, 0xFF, 0xFF, 0xFF,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, /* 0xE0 */
+	0x00, 0xF0, 0xFB, 0xF9, 0x99, 0x99, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x80, 0xE0, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x30, 0x18, 0x00, /* 0xE1 */
+	0x00, 0x3F, 0xFF, 0xFF, 0xC6, 0x83, 0x83, 0xC7, 0xFF, 0xFE, 0x7C,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, /* 0xE2 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x99, 0x99, 0x99, 0xFF, 0xFF, 0xE7, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, /* 0xE3 */
+	0x00, 0x81, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x07, 0x07, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, /* 0xE4 */
+	0x80, 0x80, 0xF0, 0xFF, 0x9F, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0x80,
+	0x07, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, /* 0xE5 */
+	0x00, 0x3C, 0xFF, 0xFF, 0xDB, 0x99, 0x99, 0x99, 0x9F, 0xDF, 0x9E,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, /* 0xE6 */
+	0xC3, 0xFF, 0x7E, 0x18, 0xFF, 0xFF, 0xFF, 0x18, 0x7E, 0xFF, 0xC3,
+	0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+	0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, /* 0xE7 */
+	0x00, 0xC7, 0xC7, 0x81, 0x99, 0x99, 0x99, 0xFF, 0xF7, 0xE7, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, /* 0xE8 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x70, 0x38, 0x0E, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x80, 0x98, 0xB8, 0x30, 0x30, 0x30, 0xB8, 0x98, 0x80, 0x00, /* 0xE9 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x70, 0x38, 0x0E, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, /* 0xEA */
+	0x00, 0xFF, 0xFF, 0xFF, 0x18, 0x1C, 0x7E, 0xF7, 0xC3, 0x81, 0x80,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, /* 0xEB */
+	0x80, 0x80, 0xE0, 0xFF, 0x7F, 0x1F, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
+	0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, /* 0xEC */
+	0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0x3C, 0x3C, 0x07, 0xFF, 0xFF, 0xFF,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, /* 0xED */
+	0x00, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, /* 0xEE */
+	0x00, 0x3C, 0xFF, 0xFF, 0xC3, 0x81, 0x81, 0xC3, 0xFF, 0xFF, 0x3C,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, /* 0xEF */
+	0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, /* 0xF0 */
+	0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0xC3, 0xFF, 0xFF, 0x7E,
+	0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, /* 0xF1 */
+	0x00, 0x3C, 0xFF, 0xFF, 0xC3, 0x81, 0x81, 0x81, 0xC7, 0x87, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, /* 0xF2 */
+	0x07, 0x07, 0x81, 0x81, 0xFF, 0xFF, 0xFF, 0x81, 0x81, 0x07, 0x07,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, /* 0xF3 */
+	0x00, 0x07, 0x1F, 0xFE, 0xF0, 0x80, 0x80, 0xF8, 0x7F, 0x0F, 0x01,
+	0x00, 0x0C, 0x18, 0x18, 0x19, 0x1F, 0x0F, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x98, 0xF8, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x00, /* 0xF4 */
+	0x7E, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x7E,
+	0x00, 0x01, 0x01, 0x01, 0x1F, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, /* 0xF5 */
+	0x00, 0x80, 0xC3, 0xE7, 0x7E, 0x1C, 0x7E, 0xE7, 0xC3, 0x00, 0x00,
+	0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, /* 0xF6 */
+	0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x80,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, /* 0xF7 */
+	0x00, 0x1F, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+	0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, /* 0xF8 */
+	0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, /* 0xF9 */
+	0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07,
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xFA */
+	0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x8C, 0x8C, 0xFC, 0xFC, 0x78, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, /* 0xFB */
+	0x00, 0xFF, 0xFF, 0xFF, 0x8C, 0xFC, 0xFC, 0xF8, 0xFF, 0xFF, 0xFF,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xFC */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x8C, 0x8C, 0x8C, 0xFC, 0xF8, 0x78,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, /* 0xFD */
+	0x00, 0x87, 0xC7, 0x81, 0x99, 0x99, 0x99, 0xDB, 0xFF, 0xFF, 0x3C,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, /* 0xFE */
+	0x00, 0xFF, 0xFF, 0xFF, 0x18, 0x7E, 0xFF, 0xFF, 0x81, 0xFF, 0xFF,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, /* 0xFF */
+	0x00, 0x9E, 0xDF, 0xFF, 0xF1, 0x71, 0x31, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+};
+#endif
+
+#if defined(SSD1306_FONT_USE_PAGE_MAJOR) && defined(SSD1306_INCLUDE_FONT_16x30)
+const uint8_t FONT_16x30_PAGES_ARRAY[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x20 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x21 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF3, 0xF3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, /* 0x22 */
+	0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x01, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0x40, 0x00, 0x80, 0xC0, 0xC0, 0x40, 0x00, 0x00, /* 0x23 */
+	0x00, 0x00, 0x18, 0x1C, 0xFC, 0xFF, 0xFF, 0x1F, 0x1C, 0xFC, 0xFF, 0xFF, 0x1F, 0x1C, 0x0C, 0x00,
+	0x00, 0x07, 0x67, 0x7F, 0x7F, 0x1F, 0x07, 0x67, 0x7F, 0x7F, 0x1F, 0x07, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xF8, 0xF8, 0xF8, 0xE0, 0xE0, 0xE0, 0x40, 0x00, 0x00, /* 0x24 */
+	0x00, 0x00, 0x0F, 0x3F, 0x3F, 0x7F, 0x79, 0xF0, 0xFF, 0xFF, 0xE0, 0xC0, 0xC1, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x40, 0xF0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xE1, 0xF1, 0x7F, 0x7F, 0x3F, 0x1F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0xC0, 0xE0, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0x40, /* 0x25 */
+	0x0F, 0x1F, 0x3F, 0x30, 0x30, 0x3F, 0x9F, 0xEF, 0xF0, 0x38, 0x9C, 0x8F, 0x87, 0x81, 0x00, 0x00,
+	0x40, 0xE0, 0x78, 0x3C, 0x0E, 0x07, 0x03, 0x01, 0x3E, 0x7F, 0xFF, 0xC1, 0xC1, 0xFF, 0x7F, 0x3E,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x26 */
+	0x00, 0x80, 0xC7, 0xFF, 0xFF, 0x7F, 0xF8, 0xFC, 0xCF, 0x8F, 0x03, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
+	0x1F, 0x3F, 0x7F, 0xFF, 0xF0, 0xE0, 0xE0, 0xE3, 0xE7, 0x7F, 0x7F, 0x3E, 0x3E, 0x7F, 0xF7, 0xE1,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x27 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, /* 0x28 */
+	0x00, 0x00, 0xC0, 0xF8, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1E, 0x3C, 0x38, 0x18, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x29 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF8, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x38, 0x3C, 0x1E, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0xC0, 0xE0, 0x80, 0x00, 0x80, 0xE0, 0xC0, 0x40, 0x00, 0x00, 0x00, /* 0x2A */
+	0x00, 0x00, 0x1C, 0x1C, 0x1C, 0xDD, 0xEB, 0xFF, 0x1C, 0xFF, 0xEB, 0xDC, 0x1C, 0x1C, 0x1C, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x2B */
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x2C */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0xF0, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x08, 0x0C, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x2D */
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x2E */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0xF0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xC0, 0x40, 0x00, 0x00, /* 0x2F */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFE, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0xFF, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x07, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x00, /* 0x30 */
+	0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x83, 0x81, 0xC0, 0xE0, 0x70, 0x39, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
+	0x00, 0x07, 0x1F, 0x3F, 0x7F, 0x7F, 0xF3, 0xE1, 0xE0, 0xE0, 0xF0, 0x78, 0x7F, 0x3F, 0x1F, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x31 */
+	0x00, 0x00, 0x06, 0x0E, 0x07, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, /* 0x32 */
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x80, 0xE1, 0xFF, 0xFF, 0x7F, 0x1F, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE, 0xEF, 0xE7, 0xE3, 0xE1, 0xE0, 0xE0, 0xE0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, /* 0x33 */
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x78, 0x7C, 0x7E, 0x7F, 0xF7, 0xF3, 0xE1, 0xC0, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x60, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF0, 0x7F, 0x7F, 0x3F, 0x0F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, /* 0x34 */
+	0x00, 0x00, 0xC0, 0xE0, 0xF8, 0x3C, 0x1F, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, /* 0x35 */
+	0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x70, 0xF0, 0xF0, 0xE0, 0xE0, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x70, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0x7F, 0x7F, 0x3F, 0x0F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, /* 0x36 */
+	0x00, 0x00, 0xC0, 0xF8, 0xFC, 0xFE, 0xFF, 0x67, 0x73, 0x71, 0xF1, 0xF0, 0xE0, 0xE0, 0x80, 0x00,
+	0x00, 0x00, 0x0F, 0x3F, 0x7F, 0x7F, 0xF0, 0xE0, 0xE0, 0xE0, 0xF0, 0x7F, 0x7F, 0x3F, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, /* 0x37 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, /* 0x38 */
+	0x00, 0x00, 0x0F, 0x1F, 0xBF, 0xBF, 0xF9, 0xF0, 0xE0, 0xE0, 0xF1, 0xFF, 0xBF, 0x1F, 0x0F, 0x00,
+	0x00, 0x00, 0x1E, 0x3F, 0x7F, 0xFF, 0xF1, 0xE0, 0xE0, 0xE1, 0xF3, 0x7F, 0x7F, 0x3F, 0x1E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x00, /* 0x39 */
+	0x00, 0x00, 0x3E, 0x7F, 0xFF, 0xFF, 0xE1, 0xC0, 0xC0, 0xC0, 0xE1, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xE1, 0xF1, 0x71, 0x79, 0x3F, 0x1F, 0x0F, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x3A */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3C, 0x3C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0xF0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x3B */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3C, 0x3C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0xF0, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x08, 0x0C, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, /* 0x3C */
+	0x00, 0x80, 0xC0, 0xE0, 0xE0, 0x70, 0x78, 0x38, 0x1C, 0x1C, 0x0E, 0x0F, 0x07, 0x03, 0x02, 0x00,
+	0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x0E, 0x1E, 0x1C, 0x38, 0x78, 0x70, 0xE0, 0x20, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x3D */
+	0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+	0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x3E */
+	0x00, 0x02, 0x03, 0x07, 0x0F, 0x0E, 0x1C, 0x1C, 0x38, 0x78, 0x70, 0xE0, 0xE0, 0xC0, 0x80, 0x00,
+	0x00, 0x20, 0xE0, 0x70, 0x78, 0x38, 0x1C, 0x1E, 0x0E, 0x0F, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x00, /* 0x3F */
+	0x00, 0x01, 0x03, 0x01, 0x01, 0x80, 0xC0, 0xE0, 0xF0, 0xF9, 0x7F, 0x3F, 0x1F, 0x0F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF3, 0xF3, 0xF3, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x40 */
+	0x80, 0xE0, 0xF8, 0x7C, 0x1E, 0x0E, 0x0F, 0x87, 0x87, 0x87, 0x87, 0x8F, 0xFE, 0xFE, 0xF8, 0x00,
+	0x7F, 0xFF, 0xFF, 0xC0, 0x3E, 0x7F, 0xFF, 0xE7, 0xE3, 0xE3, 0xE3, 0x73, 0x7F, 0xFF, 0xFF, 0xE0,
+	0x00, 0x01, 0x07, 0x0F, 0x0F, 0x1E, 0x1C, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3C, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xE0, 0xE0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x41 */
+	0x00, 0x00, 0x00, 0xE0, 0xFC, 0xFF, 0x7F, 0x07, 0x0F, 0x7F, 0xFF, 0xFC, 0xE0, 0x00, 0x00, 0x00,
+	0xC0, 0xF8, 0xFF, 0xFF, 0x3F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x3F, 0xFF, 0xFF, 0xF8, 0xC0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x00, /* 0x42 */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF1, 0xFF, 0xFF, 0xDF, 0x8F, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0x7F, 0x7F, 0x3F, 0x1F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, /* 0x43 */
+	0x00, 0xF8, 0xFE, 0xFF, 0xFF, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00,
+	0x00, 0x03, 0x0F, 0x3F, 0x3F, 0x7C, 0x78, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFE, 0x7E, 0x7E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, /* 0x44 */
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0x7C, 0x7F, 0x3F, 0x1F, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0x45 */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, /* 0x46 */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, /* 0x47 */
+	0x00, 0xF8, 0xFE, 0xFF, 0xFF, 0x07, 0x03, 0x01, 0x00, 0xC0, 0xC0, 0xC0, 0xCF, 0xCF, 0xCF, 0x00,
+	0x00, 0x03, 0x0F, 0x3F, 0x3F, 0x7C, 0x70, 0xE0, 0xE0, 0xE1, 0xE1, 0xFF, 0xFF, 0x7F, 0x7F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0x48 */
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0x49 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, /* 0x4A */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x40, 0x70, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0x7F, 0x7F, 0x3F, 0x0F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0x20, 0x00, /* 0x4B */
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF8, 0xFE, 0xFF, 0x9F, 0x07, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x3F, 0xFE, 0xFC, 0xF0, 0xC0, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x4C */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0x4D */
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x3F, 0xFE, 0xFE, 0x3F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0x4E */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0xF8, 0xE0, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, /* 0x4F */
+	0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+	0x00, 0x07, 0x1F, 0x3F, 0x7F, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0x7F, 0x3F, 0x1F, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x00, /* 0x50 */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xFF, 0xFF, 0xFF, 0x3E, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, /* 0x51 */
+	0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+	0x00, 0x07, 0x3F, 0x7F, 0x7F, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0x7F, 0x7F, 0x1F, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x1F, 0x1E, 0x1C, 0x1C, 0x1E, 0x0C, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, /* 0x52 */
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xE1, 0xFF, 0xFF, 0x7F, 0x1F, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x07, 0x1F, 0x7F, 0xFE, 0xF8, 0xE0, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x00, 0x00, /* 0x53 */
+	0x00, 0x00, 0x1F, 0x3F, 0x7F, 0x7F, 0x79, 0xF0, 0xF0, 0xE0, 0xE0, 0xCF, 0xCF, 0x8F, 0x00, 0x00,
+	0x00, 0x00, 0x7E, 0x7E, 0x7E, 0xF0, 0xE0, 0xE0, 0xE0, 0xE1, 0xF1, 0x7F, 0x7F, 0x3F, 0x1F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, /* 0x54 */
+	0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07,
+	0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0x55 */
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x0F, 0x3F, 0x7F, 0x7F, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0x7F, 0x7F, 0x3F, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xE0, 0xE0, 0x60, /* 0x56 */
+	0x00, 0x03, 0x1F, 0xFF, 0xFF, 0xFC, 0xE0, 0x00, 0x00, 0x80, 0xF8, 0xFF, 0xFF, 0x1F, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x7F, 0xFF, 0xFE, 0xFC, 0xFF, 0x7F, 0x0F, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, /* 0x57 */
+	0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0xF0, 0xF8, 0xF8, 0xF8, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0x03,
+	0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x7F, 0x0F, 0x03, 0x01, 0x0F, 0x7F, 0xFE, 0xFF, 0xFF, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x60, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xE0, 0xE0, 0x60, 0x20, /* 0x58 */
+	0x00, 0x00, 0x01, 0x03, 0x0F, 0xBF, 0xFF, 0xFC, 0xF8, 0xFE, 0xBF, 0x0F, 0x07, 0x01, 0x00, 0x00,
+	0x80, 0xE0, 0xF0, 0xFC, 0x7F, 0x3F, 0x0F, 0x03, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xE0, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0xE0, 0xE0, 0xE0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0x20, /* 0x59 */
+	0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0x5A */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0xF8, 0xFE, 0x3F, 0x1F, 0x07, 0x03, 0x01, 0x00,
+	0x00, 0x00, 0xF0, 0xFC, 0xFE, 0xFF, 0xEF, 0xE7, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, /* 0x5B */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x40, 0xC0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x5C */
+	0x00, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFE, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0xFF, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x07, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, /* 0x5D */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x5E */
+	0x00, 0x40, 0x60, 0x78, 0x7C, 0x1E, 0x0F, 0x03, 0x01, 0x03, 0x0F, 0x1F, 0x7C, 0x78, 0x60, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x5F */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x60, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x60 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x61 */
+	0x00, 0x00, 0x18, 0x38, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0xFC, 0xFC, 0xF8, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x3E, 0x7F, 0xFF, 0xFF, 0xE3, 0xE1, 0xE1, 0x71, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x62 */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x1C, 0x1C, 0x1C, 0x3C, 0xFC, 0xF8, 0xF0, 0xE0, 0x00,
+	0x00, 0x00, 0x7F, 0x7F, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0x7F, 0x7F, 0x3F, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x63 */
+	0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0x7C, 0x3C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0x3F, 0x7F, 0x7F, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0x60, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, /* 0x64 */
+	0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0x7C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x0F, 0x3F, 0x7F, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0x70, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x65 */
+	0x00, 0xC0, 0xF0, 0xF0, 0xF8, 0xBC, 0x9C, 0x9C, 0x9C, 0x9C, 0xBC, 0xFC, 0xF8, 0xF0, 0xE0, 0x00,
+	0x00, 0x0F, 0x3F, 0x3F, 0x7F, 0x73, 0xF3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0x73, 0x73, 0x63, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x40, 0x00, /* 0x66 */
+	0x00, 0x00, 0x1C, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x1C, 0x1C, 0x1C, 0x1D, 0x1C, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x67 */
+	0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0x7C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xF8, 0x00, 0x00,
+	0x00, 0x1F, 0x3F, 0x7F, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x1C, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x3C, 0x3F, 0x1F, 0x0F, 0x07, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x68 */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x18, 0x1C, 0x1C, 0x3C, 0xFC, 0xFC, 0xF8, 0xF0, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x69 */
+	0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFD, 0xFD, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, /* 0x6A */
+	0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1D, 0xFD, 0xFD, 0xFC, 0xFC, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x1C, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x3E, 0x1F, 0x1F, 0x0F, 0x03, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x6B */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0x7C, 0x1C, 0x0C, 0x04, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x07, 0x0F, 0x1F, 0x7E, 0xFC, 0xF0, 0xE0, 0xE0, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x6C */
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x7F, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0x70, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x6D */
+	0x00, 0xFC, 0xFC, 0xFC, 0xF8, 0x18, 0x1C, 0xFC, 0xFC, 0xFC, 0xF0, 0x18, 0x1C, 0xFC, 0xFC, 0xFC,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x6E */
+	0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xF8, 0x38, 0x18, 0x1C, 0x1C, 0x3C, 0xFC, 0xFC, 0xF8, 0xF0, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x6F */
+	0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x7C, 0xF8, 0xF8, 0xF0, 0xC0, 0x00,
+	0x00, 0x0F, 0x3F, 0x7F, 0x7F, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0x7F, 0x7F, 0x3F, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x70 */
+	0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xF0, 0x38, 0x1C, 0x1C, 0x1C, 0x3C, 0xFC, 0xF8, 0xF0, 0xE0, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0x7F, 0x7F, 0x3F, 0x0F, 0x00,
+	0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x71 */
+	0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0x7C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xF8, 0x00, 0x00,
+	0x00, 0x0F, 0x3F, 0x7F, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x72 */
+	0x00, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xF8, 0x38, 0x18, 0x1C, 0x7C, 0x7C, 0x78, 0x70, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x73 */
+	0x00, 0x00, 0xF0, 0xF8, 0xF8, 0xFC, 0x9C, 0x9C, 0x9C, 0x1C, 0x1C, 0x38, 0x38, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x79, 0x71, 0xF3, 0xE3, 0xE3, 0xE7, 0xE7, 0xFF, 0x7F, 0x7E, 0x3C, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x74 */
+	0x1C, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0x3F, 0x7F, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0x70, 0x78, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x75 */
+	0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00,
+	0x00, 0x00, 0x3F, 0x7F, 0xFF, 0xFF, 0xF0, 0xE0, 0x60, 0x70, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x76 */
+	0x00, 0x04, 0x3C, 0xFC, 0xFC, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xFC, 0xFC, 0x3C, 0x04,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x7F, 0xFF, 0xF8, 0xFC, 0xFF, 0x3F, 0x07, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x77 */
+	0x0C, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x80, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0xF0, 0xFC, 0xFC, 0x1C,
+	0x00, 0x01, 0x3F, 0xFF, 0xFF, 0xFC, 0xFF, 0x1F, 0x07, 0x7F, 0xFE, 0xF8, 0xFF, 0x7F, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x78 */
+	0x00, 0x04, 0x0C, 0x1C, 0x7C, 0xFC, 0xF0, 0xE0, 0x80, 0xE0, 0xF0, 0xFC, 0x7C, 0x1C, 0x0C, 0x04,
+	0x00, 0x80, 0xC0, 0xF0, 0xF8, 0x7E, 0x3F, 0x0F, 0x07, 0x1F, 0x3F, 0xFE, 0xF8, 0xF0, 0xC0, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x79 */
+	0x04, 0x3C, 0xFC, 0xFC, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFC, 0xFC, 0x7C, 0x0C, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xFC, 0xF0, 0xE0, 0xFC, 0xFF, 0x3F, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x3C, 0x38, 0x38, 0x38, 0x3F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x7A */
+	0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x9C, 0xDC, 0xFC, 0xFC, 0x7C, 0x3C, 0x3C, 0x00,
+	0x00, 0x00, 0xF0, 0xF0, 0xF8, 0xFC, 0xFE, 0xEF, 0xE7, 0xE3, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0x7B */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x07, 0x07, 0x0F, 0xFD, 0xFD, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x3F, 0x3F, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x7C */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x7D */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFD, 0xFD, 0xFD, 0x0F, 0x07, 0x07, 0x07, 0x00,
+	0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x3C, 0x3F, 0x3F, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x7E */
+	0x00, 0x00, 0x20, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x70, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0x60, 0x60, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x7F */
+	0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, /* 0x80 */
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x70, 0x70, 0xF0, 0xF0, 0xE0, 0xC0, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0xE0, 0xF0, 0xFF, 0x7F, 0x3F, 0x1F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE8, 0xEC, 0xEE, 0xEE, 0xE6, 0xE6, 0xE2, 0xE0, 0x00, /* 0x81 */
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x82 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0xF0, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0x60, 0x20, 0x00, 0x00, 0x00, 0x00, /* 0x83 */
+	0x00, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xFD, 0x1D, 0x1D, 0x1C, 0x1C, 0x7C, 0x7C, 0x7C, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x84 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x60, 0xF0, 0xF0, 0xF0, 0xE0, 0x00, 0x60, 0xF0, 0xF0, 0xF0, 0xE0, 0x00, 0x00,
+	0x00, 0x00, 0x04, 0x0C, 0x0E, 0x07, 0x03, 0x01, 0x04, 0x0C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x85 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xF0, 0xF0, 0x60, 0x00, 0x00, 0x00, 0x60, 0xF0, 0xF0, 0x60, 0x00, 0x00, 0x00, 0x60, 0xF0, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x86 */
+	0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x87 */
+	0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00,
+	0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x40, /* 0x88 */
+	0x00, 0x18, 0x9C, 0xFC, 0xFF, 0xFF, 0xFF, 0x9F, 0x9D, 0x9C, 0x9C, 0x9C, 0x9C, 0x0C, 0x00, 0x00,
+	0x00, 0x03, 0x03, 0x07, 0x1F, 0x3F, 0x7F, 0x7F, 0xF3, 0xF3, 0xE3, 0xE3, 0xE1, 0xE0, 0xF0, 0x60,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xC0, 0xE0, 0xE0, 0x60, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x89 */
+	0x87, 0x8F, 0xCF, 0xCC, 0x4F, 0x67, 0x67, 0x30, 0x30, 0x10, 0x18, 0x18, 0x0C, 0x0C, 0x00, 0x00,
+	0x00, 0x7D, 0xFE, 0xFE, 0xC6, 0xFE, 0x7E, 0x7C, 0x00, 0x7C, 0xFE, 0xFE, 0xC6, 0xFE, 0x7E, 0x7C,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x8A */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0xF8, 0xF8, 0xF0, 0xC0,
+	0xE0, 0xFE, 0x7F, 0x3F, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0x7F, 0x7F, 0x1F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x8B */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0x78, 0x1C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0F, 0x1E, 0x3C, 0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x8C */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x70, 0xF0, 0xF0, 0xE0, 0xC0,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0x7F, 0x7F, 0x1F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x08, 0x0C, 0x0E, 0xCE, 0xE6, 0xE6, 0xE2, 0x20, 0x00, /* 0x8D */
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF8, 0xFE, 0xFF, 0x9F, 0x07, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x3F, 0xFE, 0xFC, 0xF0, 0xC0, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, /* 0x8E */
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x70, 0x70, 0xF0, 0xF0, 0xF0, 0xE0, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0x8F */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x90 */
+	0x00, 0x0C, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x8C, 0xCC, 0xCC, 0xC0, 0xC0, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x01, 0x01, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x3F, 0x3F, 0x1F, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00, /* 0x91 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x1F, 0x1E, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x92 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x18, 0x1D, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0x60, 0x40, 0x00, 0x80, 0xC0, 0xE0, 0x60, 0x40, 0x00, /* 0x93 */
+	0x00, 0x00, 0x00, 0x0F, 0x1F, 0x1F, 0x1E, 0x0C, 0x00, 0x0F, 0x1F, 0x1F, 0x1E, 0x0C, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, /* 0x94 */
+	0x00, 0x00, 0x08, 0x18, 0x1D, 0x0F, 0x07, 0x03, 0x08, 0x18, 0x1D, 0x0F, 0x07, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x95 */
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x96 */
+	0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x97 */
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x98 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0xE0, 0x80, 0x80, 0xE0, 0xE0, 0xE0, /* 0x99 */
+	0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x0F, 0x07, 0x7F, 0x7F, 0x7F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x9A */
+	0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xF8, 0xFF, 0x7F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0x7F, 0x7F, 0x3E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x9B */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1C, 0x78, 0xF0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x78, 0x3C, 0x1E, 0x0F, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x9C */
+	0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x80, 0x80, 0xFC, 0xFC, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0x7F, 0x7F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0x60, 0x20, 0x00, 0x00, 0x00, 0x00, /* 0x9D */
+	0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x01, 0x01, 0xC1, 0xE0, 0xF0, 0x7C, 0x3C, 0x1C, 0x0C, 0x04,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x07, 0x1F, 0x3F, 0x7C, 0xF8, 0xE0, 0xE0, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x9E */
+	0x00, 0x0C, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0xCC, 0xCC, 0xCC, 0xC0, 0xC0, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x01, 0x01, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0x9F */
+	0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xA0 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0xE0, 0xE0, 0xE3, 0xC7, 0x0F, 0x0E, 0x0C, 0x0C, 0x0C, 0x0F, 0x07, 0xE3, 0xE0, 0xE0, 0x60, /* 0xA1 */
+	0x00, 0x01, 0x07, 0x3F, 0xFF, 0xFE, 0xF0, 0xC0, 0x80, 0x80, 0xF8, 0xFF, 0xFF, 0x1F, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE3, 0xE3, 0xF3, 0x7F, 0x7F, 0x3F, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0xE0, 0xE0, 0xC0, 0x80, 0x80, 0xE0, 0xE0, 0x40, 0x00, 0x00, 0x00, /* 0xA2 */
+	0x04, 0x3C, 0xFC, 0xFC, 0xF0, 0x80, 0x01, 0x01, 0x01, 0x01, 0xC1, 0xFC, 0xFC, 0x7C, 0x0C, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xFC, 0xF0, 0xE0, 0xFC, 0xFF, 0x3F, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x3C, 0x38, 0x38, 0x38, 0x3F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, /* 0xA3 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x40, 0x70, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF8, 0x7F, 0x7F, 0x3F, 0x0F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xA4 */
+	0x00, 0x06, 0x0F, 0xFE, 0xFC, 0xF8, 0x3C, 0x1C, 0x1C, 0x3C, 0xF8, 0xFC, 0xFE, 0x0F, 0x04, 0x00,
+	0x00, 0x18, 0x3C, 0x1F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0E, 0x0F, 0x0F, 0x1F, 0x1F, 0x3C, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFE, 0xFE, 0xFE, 0x00, /* 0xA5 */
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xA6 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, /* 0xA7 */
+	0x00, 0x00, 0xE0, 0xFB, 0xFF, 0xFF, 0x1F, 0x1C, 0x1C, 0x3C, 0xFC, 0xF9, 0xF8, 0xE0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x71, 0x63, 0xE3, 0xE7, 0xE7, 0xE7, 0xFF, 0xFF, 0x7F, 0x39, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0xE0, 0x00, /* 0xA8 */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xA9 */
+	0x00, 0xE0, 0xF8, 0x3C, 0x0C, 0xCE, 0xF6, 0x36, 0x36, 0x36, 0x0E, 0x0C, 0x3C, 0xF8, 0xE0, 0x00,
+	0x00, 0x07, 0x1F, 0x3C, 0x30, 0x73, 0x6F, 0x6C, 0x6C, 0x6C, 0x70, 0x30, 0x3C, 0x1F, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, /* 0xAA */
+	0x00, 0xF8, 0xFE, 0xFF, 0xFF, 0xE7, 0xE3, 0xE1, 0xE0, 0xE0, 0xE0, 0x00, 0x07, 0x07, 0x07, 0x00,
+	0x00, 0x03, 0x0F, 0x3F, 0x3F, 0x7C, 0x70, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFE, 0xFE, 0x7E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xAB */
+	0x00, 0x00, 0x80, 0xE0, 0xF0, 0x78, 0x1C, 0x08, 0x80, 0xE0, 0xF0, 0x78, 0x1C, 0x08, 0x00, 0x00,
+	0x00, 0x01, 0x03, 0x0F, 0x1E, 0x3C, 0x78, 0x31, 0x03, 0x0F, 0x1E, 0x3C, 0x78, 0x30, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xAC */
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xAD */
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0xC0, 0x80, 0x00, /* 0xAE */
+	0x00, 0x3E, 0xFF, 0xC1, 0x80, 0x7F, 0x7F, 0x11, 0x1B, 0x3F, 0x6E, 0x40, 0x00, 0xC1, 0xFF, 0x3E,
+	0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0xE0, 0x00, /* 0xAF */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, /* 0xB0 */
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x3F, 0x38, 0x38, 0x38, 0x3F, 0x1F, 0x0F, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xB1 */
+	0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00,
+	0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0xB2 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xB3 */
+	0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFD, 0xFD, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x00, 0x00, /* 0xB4 */
+	0x00, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xFC, 0x1C, 0x1C, 0x1C, 0x1C, 0x7F, 0x7F, 0x7F, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xB5 */
+	0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0x70, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0x00, 0x00, /* 0xB6 */
+	0x00, 0x00, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xB7 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, /* 0xB8 */
+	0x00, 0xC0, 0xF0, 0xF0, 0xF9, 0xBD, 0x9C, 0x9C, 0x9C, 0x9C, 0xBC, 0xFD, 0xF9, 0xF0, 0xE0, 0x00,
+	0x00, 0x0F, 0x3F, 0x3F, 0x7F, 0x73, 0xF3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0x73, 0x73, 0x63, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0x00, 0x80, 0xE0, 0x60, 0x60, 0xE0, 0x80, /* 0xB9 */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x8F, 0xBF, 0xB0, 0xB0, 0xBF, 0x8F,
+	0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xBA */
+	0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xB8, 0x9C, 0x9C, 0x9C, 0x9C, 0x1C, 0xFC, 0xF8, 0xF8, 0x00,
+	0x00, 0x00, 0x0F, 0x1F, 0x3F, 0x7F, 0x7B, 0xF3, 0xE3, 0xE3, 0xE3, 0xE0, 0xE0, 0xF0, 0x70, 0x60,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xBB */
+	0x00, 0x00, 0x08, 0x1C, 0x78, 0xF0, 0xE0, 0x80, 0x08, 0x1C, 0x78, 0xF0, 0xE0, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x78, 0x3C, 0x1E, 0x0F, 0x03, 0x31, 0x78, 0x3C, 0x1E, 0x0F, 0x03, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, /* 0xBC */
+	0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1D, 0xFD, 0xFD, 0xFC, 0xFC, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x1C, 0x3C, 0x38, 0x38, 0x38, 0x38, 0x3E, 0x1F, 0x1F, 0x0F, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x00, 0x00, /* 0xBD */
+	0x00, 0x00, 0x1F, 0x3F, 0x7F, 0x7F, 0x79, 0xF0, 0xF0, 0xE0, 0xE0, 0xCF, 0xCF, 0x8F, 0x00, 0x00,
+	0x00, 0x00, 0x7E, 0x7E, 0x7E, 0xF0, 0xE0, 0xE0, 0xE0, 0xE1, 0xF1, 0x7F, 0x7F, 0x3F, 0x1F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xBE */
+	0x00, 0x00, 0xF0, 0xF8, 0xF8, 0xFC, 0x9C, 0x9C, 0x9C, 0x1C, 0x1C, 0x38, 0x38, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x79, 0x71, 0xF3, 0xE3, 0xE3, 0xE7, 0xE7, 0xFF, 0x7F, 0x7E, 0x3C, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x60, 0xF0, 0xF0, 0x60, 0x00, 0x00, 0x00, 0x60, 0xF0, 0xF0, 0x60, 0x00, 0x00, /* 0xBF */
+	0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xE0, 0xE0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xC0 */
+	0x00, 0x00, 0x00, 0xE0, 0xFC, 0xFF, 0x7F, 0x07, 0x0F, 0x7F, 0xFF, 0xFC, 0xE0, 0x00, 0x00, 0x00,
+	0xC0, 0xF8, 0xFF, 0xFF, 0x3F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x3F, 0xFF, 0xFF, 0xF8, 0xC0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, /* 0xC1 */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x70, 0x70, 0x70, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0x7F, 0x7F, 0x3F, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x00, /* 0xC2 */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF1, 0xFF, 0xFF, 0xDF, 0x8F, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0x7F, 0x7F, 0x3F, 0x1F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0xC3 */
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, /* 0xC4 */
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0xE0, 0xE0, 0xF0, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0,
+	0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0xC5 */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0x20, /* 0xC6 */
+	0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
+	0xC0, 0xFC, 0xFF, 0xFF, 0x3F, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x3F, 0xFF, 0xFF, 0xFC, 0xC0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, /* 0xC7 */
+	0x00, 0x07, 0x07, 0x07, 0x00, 0xE0, 0xE0, 0xE0, 0xF1, 0xFF, 0xFF, 0x9F, 0x8F, 0x00, 0x00, 0x00,
+	0x00, 0x7E, 0x7E, 0xFE, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF1, 0x7F, 0x7F, 0x3F, 0x1F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0xC8 */
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xF0, 0xFC, 0x7F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE3, 0xE7, 0x0F, 0x0E, 0x0C, 0x0C, 0x0C, 0xCF, 0xE7, 0xE3, 0xE0, 0xE0, 0x00, /* 0xC9 */
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0xF0, 0xFC, 0x7F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0x20, 0x00, /* 0xCA */
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF8, 0xFE, 0xFF, 0x9F, 0x07, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x3F, 0xFE, 0xFC, 0xF0, 0xC0, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0xCB */
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0xE0, 0xE0, 0xF0, 0xFF, 0x7F, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0xCC */
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x3F, 0xFE, 0xFE, 0x3F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0xCD */
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, /* 0xCE */
+	0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+	0x00, 0x07, 0x1F, 0x3F, 0x7F, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0x7F, 0x3F, 0x1F, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0xCF */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00, 0x00, /* 0xD0 */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xFF, 0xFF, 0xFF, 0x3E, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, /* 0xD1 */
+	0x00, 0xF8, 0xFE, 0xFF, 0xFF, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x00,
+	0x00, 0x03, 0x0F, 0x3F, 0x3F, 0x7C, 0x78, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFE, 0x7E, 0x7E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, /* 0xD2 */
+	0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07,
+	0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0x60, /* 0xD3 */
+	0x00, 0x01, 0x07, 0x3F, 0xFF, 0xFE, 0xF0, 0xC0, 0x80, 0x80, 0xF8, 0xFF, 0xFF, 0x1F, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0xC0, 0xE0, 0xE3, 0xE3, 0xF3, 0x7F, 0x7F, 0x3F, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xE0, 0xE0, 0xE0, 0xE0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, /* 0xD4 */
+	0xF8, 0xFE, 0xFF, 0xFF, 0x07, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x07, 0xFF, 0xFF, 0xFE, 0xF8,
+	0x03, 0x0F, 0x1F, 0x1F, 0x3C, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x3C, 0x1F, 0x1F, 0x0F, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x60, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xE0, 0xE0, 0x60, 0x20, /* 0xD5 */
+	0x00, 0x00, 0x01, 0x03, 0x0F, 0xBF, 0xFF, 0xFC, 0xF8, 0xFE, 0xBF, 0x0F, 0x07, 0x01, 0x00, 0x00,
+	0x80, 0xE0, 0xF0, 0xFC, 0x7F, 0x3F, 0x0F, 0x03, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xE0, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, /* 0xD6 */
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0xD7 */
+	0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, /* 0xD8 */
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0xD9 */
+	0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F,
+	0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xDA */
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38, 0x78, 0xF8, 0xF0, 0xE0, 0xC0,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xF0, 0x7F, 0x7F, 0x3F, 0x0F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0xDB */
+	0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x78, 0xF8, 0xF0, 0xF0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xF0, 0x7F, 0x7F, 0x3F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xDC */
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x38, 0x38, 0x38, 0x78, 0xF8, 0xF0, 0xE0, 0xC0, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0x7F, 0x7F, 0x3F, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, /* 0xDD */
+	0x00, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0xE0, 0xE0, 0xE1, 0xE1, 0xE7, 0xFF, 0xFF, 0xFE, 0xF8, 0x00,
+	0x00, 0x7E, 0xFE, 0xFE, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0x70, 0x7C, 0x3F, 0x3F, 0x0F, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x80, 0x00, /* 0xDE */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFE, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x3F, 0x7F, 0xFF, 0xF0, 0xE0, 0xF0, 0xFF, 0x7F, 0x3F, 0x0F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, /* 0xDF */
+	0x00, 0x00, 0x3E, 0x7F, 0xFF, 0xFF, 0xE1, 0xE0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x80, 0xE0, 0xF8, 0xFC, 0xFF, 0x3F, 0x0F, 0x07, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xE0 */
+	0x00, 0x00, 0x18, 0x38, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0xFC, 0xFC, 0xF8, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x3E, 0x7F, 0xFF, 0xFF, 0xE3, 0xE1, 0xE1, 0x71, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0x00, 0x00, 0x00, /* 0xE1 */
+	0x00, 0xF8, 0xFF, 0xFF, 0xE7, 0x71, 0x39, 0x38, 0x38, 0x38, 0x78, 0xF8, 0xF0, 0xE0, 0xC0, 0x00,
+	0x00, 0x07, 0x1F, 0x3F, 0x7F, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xF8, 0x7F, 0x7F, 0x3F, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xE2 */
+	0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x9C, 0x9C, 0x9C, 0x9C, 0xFC, 0xFC, 0xF8, 0x70, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xF3, 0xFF, 0x7F, 0x7E, 0x3C, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xE3 */
+	0x00, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xFC, 0x1C, 0x1C, 0x1C, 0x1C, 0x7C, 0x7C, 0x7C, 0x00, 0x00,
+	0x00, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xE4 */
+	0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00,
+	0xE0, 0xE0, 0xF8, 0xFF, 0xFF, 0xFF, 0xE1, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0x00,
+	0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xE5 */
+	0x00, 0xC0, 0xF0, 0xF0, 0xF8, 0xBC, 0x9C, 0x9C, 0x9C, 0x9C, 0xBC, 0xFC, 0xF8, 0xF0, 0xE0, 0x00,
+	0x00, 0x0F, 0x3F, 0x3F, 0x7F, 0x73, 0xF3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0x73, 0x73, 0x63, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xE6 */
+	0x1C, 0x7C, 0xFC, 0xF0, 0x80, 0x80, 0xFC, 0xFC, 0xFC, 0xFC, 0x80, 0xC0, 0xF0, 0xFC, 0x7C, 0x1C,
+	0xF0, 0xFC, 0xFF, 0x1F, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x3F, 0xFF, 0xFE, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xE7 */
+	0x00, 0x00, 0xF8, 0xF8, 0xFC, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xF8, 0x70, 0x00, 0x00,
+	0x00, 0x28, 0x70, 0x70, 0xF0, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3, 0xF3, 0xFF, 0x7E, 0x7E, 0x3C, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xE8 */
+	0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFC, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0x3C, 0x1F, 0x07, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0xE0, 0xE0, 0xC0, 0x80, 0x80, 0xE0, 0xE0, 0x40, 0x00, 0x00, 0x00, /* 0xE9 */
+	0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x01, 0x01, 0x81, 0xE1, 0xF1, 0xF8, 0xFC, 0xFC, 0xFC, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0x3C, 0x1F, 0x07, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xEA */
+	0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0x7C, 0x3C, 0x1C, 0x0C, 0x04,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x07, 0x1F, 0x3F, 0x7C, 0xF8, 0xE0, 0xE0, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xEB */
+	0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00,
+	0xE0, 0xE0, 0xF0, 0xFE, 0x7F, 0x7F, 0x1F, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xEC */
+	0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0xF8, 0xE0, 0xC0, 0x80, 0xE0, 0xF8, 0xFC, 0xFC, 0xFC, 0xFC, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x0F, 0x0F, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xED */
+	0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0xFC, 0xFC, 0xFC, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xEE */
+	0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x7C, 0xF8, 0xF8, 0xF0, 0xC0, 0x00,
+	0x00, 0x0F, 0x3F, 0x7F, 0x7F, 0xF8, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0x7F, 0x7F, 0x3F, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xEF */
+	0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xFC, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xF0 */
+	0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xF0, 0x38, 0x1C, 0x1C, 0x1C, 0x3C, 0xFC, 0xF8, 0xF0, 0xE0, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xF8, 0x7F, 0x7F, 0x3F, 0x0F, 0x00,
+	0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xF1 */
+	0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0x7C, 0x3C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0x3F, 0x7F, 0x7F, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0x60, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xF2 */
+	0x00, 0x7C, 0x7C, 0x7C, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xFC, 0x1C, 0x1C, 0x7C, 0x7C, 0x7C, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xF3 */
+	0x04, 0x3C, 0xFC, 0xFC, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFC, 0xFC, 0x7C, 0x0C, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x1F, 0xFF, 0xFC, 0xF0, 0xE0, 0xFC, 0xFF, 0x3F, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x3C, 0x38, 0x38, 0x38, 0x3F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xF4 */
+	0xE0, 0xF8, 0xF8, 0xFC, 0x3C, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x3C, 0xFC, 0xFC, 0xF8, 0xE0,
+	0x1F, 0x7F, 0xFF, 0xFF, 0xF0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0x7F, 0x7F, 0x1F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xF5 */
+	0x00, 0x04, 0x0C, 0x1C, 0x7C, 0xFC, 0xF0, 0xE0, 0x80, 0xE0, 0xF0, 0xFC, 0x7C, 0x1C, 0x0C, 0x04,
+	0x00, 0x80, 0xC0, 0xF0, 0xF8, 0x7E, 0x3F, 0x0F, 0x07, 0x1F, 0x3F, 0xFE, 0xF8, 0xF0, 0xC0, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xF6 */
+	0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xF7 */
+	0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00,
+	0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xF8 */
+	0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xF9 */
+	0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xFA */
+	0x00, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xFF, 0x7F, 0x7F, 0x3E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xFB */
+	0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xFF, 0xFF, 0x7F, 0x3E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xFC */
+	0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xE3, 0xE3, 0xE3, 0xFF, 0x7F, 0x7F, 0x1E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xFD */
+	0x00, 0xF0, 0xF8, 0xF8, 0x1C, 0x1C, 0x9C, 0x9C, 0x9C, 0x9C, 0xBC, 0xF8, 0xF8, 0xF0, 0xC0, 0x00,
+	0x00, 0x60, 0x70, 0x70, 0xE0, 0xE0, 0xE3, 0xE3, 0xE3, 0xF3, 0xF3, 0x7F, 0x7F, 0x3F, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xFE */
+	0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x80, 0xE0, 0xF8, 0xFC, 0xFC, 0x1C, 0xFC, 0xFC, 0xF8, 0xE0, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x1F, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x7F, 0x1F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 0xFF */
+	0x00, 0x00, 0xE0, 0xF0, 0xF8, 0xFC, 0x3C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00,
+	0x00, 0xE0, 0xE3, 0xE7, 0xF7, 0xFF, 0x7F, 0x3E, 0x0E, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+#endif
+
@@ -4,13 +4,21 @@
  * See LICENSE file for details.
  */
 
-#include "ssd1306_port.h"
+#ifndef SSD1306_MCU_HOST
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ssd1306_port_stm32.h"
 
 /* Internal bus configuration (I2C instance, address, timeout) */
 static ssd1306_bus_t ssd1306_bus;
 
-/* Shortcut to the active I2C peripheral */
+/* Shortcut to the active peripheral */
+#ifdef SSD1306_USE_SPI
+#define SPIx (ssd1306_bus.spi)
+#else
 #define I2Cx (ssd1306_bus.i2c)
+#endif
 
 /* =======================================================================
  * Timing helpers (DWT-based and fallback)
@@ -20,6 +28,16 @@ static ssd1306_bus_t ssd1306_bus;
 static uint8_t  _use_dwt = 0;
 static uint32_t _core_hz = 0;
 
+/* Flush deadline shared by every wait of a flush (DWT cycles, or
+ * fallback loop iterations left) */
+static uint8_t  _deadline_armed = 0;
+static uint32_t _deadline_start;
+static uint32_t _deadline_span;
+
+/* Set while a queue interrupt waits on the bus: the wait is capped at
+ * SSD1306_PORT_IRQ_WAIT_US and leaves the flush deadline alone */
+static uint8_t  _wait_in_irq = 0;
+
 /* Initialize timing helpers (DWT cycle counter or fallback) */
 static void ssd1306_port_timing_init(void) {
 	uint32_t a, b;
@@ -38,6 +56,40 @@ static void ssd1306_port_timing_init(void) {
 	_use_dwt = (b != a);
 }
 
+#if defined(SSD1306_USE_SPI) || defined(SSD1306_I2C_SCL_GPIO)
+
+/* Drive one output pin through the atomic set/reset register */
+static void ssd1306_port_pin_write(GPIO_TypeDef *gpio, uint8_t pin, uint8_t level) {
+	gpio->BSRR = level ? (1UL << pin) : (1UL << (pin + 16U));
+}
+
+#endif
+
+#ifdef SSD1306_USE_SPI
+
+/* RES# low for at least 3 us resets the controller */
+static void ssd1306_port_spi_reset(void) {
+#ifdef SSD1306_SPI_RST_GPIO
+	ssd1306_port_pin_write(SSD1306_SPI_RST_GPIO, SSD1306_SPI_RST_PIN, 0);
+	SSD1306_DELAY_MS(1);
+	ssd1306_port_pin_write(SSD1306_SPI_RST_GPIO, SSD1306_SPI_RST_PIN, 1);
+	SSD1306_DELAY_MS(1);
+#endif
+}
+
+void ssd1306_port_init(SPI_TypeDef *spi, uint32_t timeout_ms) {
+	ssd1306_port_timing_init();
+	ssd1306_bus.spi     = spi;
+	ssd1306_bus.timeout = timeout_ms;
+
+	ssd1306_port_pin_write(SSD1306_SPI_CS_GPIO, SSD1306_SPI_CS_PIN, 1);
+	ssd1306_port_pin_write(SSD1306_SPI_DC_GPIO, SSD1306_SPI_DC_PIN, 0);
+
+	ssd1306_port_spi_reset();
+}
+
+#else
+
 void ssd1306_port_init(I2C_TypeDef *i2c, uint16_t addr8, uint32_t timeout_ms) {
 	ssd1306_port_timing_init();
 	ssd1306_bus.i2c     = i2c;
@@ -45,26 +97,54 @@ void ssd1306_port_init(I2C_TypeDef *i2c, uint16_t addr8, uint32_t timeout_ms) {
 	ssd1306_bus.timeout = timeout_ms;
 }
 
+#endif
+
 /* =======================================================================
  * Generic wait helper with timeout
  * ======================================================================= */
 /*
- * Returns 0 on success, -1 on timeout.
+ * Returns 0 on success, -1 on timeout. Inside a flush the wait also ends
+ * at the flush deadline (ssd1306_port_deadline); in a queue interrupt it
+ * ends after SSD1306_PORT_IRQ_WAIT_US.
  */
 static int wait_ok(int (*ok)(void), uint32_t ms) {
 	uint64_t budget;
+	uint64_t cap;
 	uint32_t start;
+	uint32_t elapsed;
 	uint32_t loops;
+	uint32_t spent;
+	uint8_t armed;
+	int rc;
 
 	if (ms == 0U) {
 		return ok() ? 0 : -1;
 	}
 
+	armed = (uint8_t)(_deadline_armed && !_wait_in_irq);
+
 	if (_use_dwt) {
 		/* Deadline in core cycles */
 		budget = ((uint64_t)_core_hz * (uint64_t)ms) / 1000ULL;
 		start  = DWT->CYCCNT;
 
+		if (_wait_in_irq) {
+			cap = ((uint64_t)_core_hz * SSD1306_PORT_IRQ_WAIT_US) / 1000000ULL;
+			if (budget > cap) {
+				budget = cap;
+			}
+		}
+
+		if (armed) {
+			elapsed = start - _deadline_start;
+			if (elapsed >= _deadline_span) {
+				return ok() ? 0 : -1;
+			}
+			if (budget > (uint64_t)(_deadline_span - elapsed)) {
+				budget = _deadline_span - elapsed;
+			}
+		}
+
 		for (;;) {
 			if (ok()) {
 				return 0;
@@ -79,38 +159,107 @@ static int wait_ok(int (*ok)(void), uint32_t ms) {
 	/* Coarse fallback without DWT (iteration-based) */
 	/* Factor 8 ≈ cycles per loop (conservative) */
 	loops = ((_core_hz / 1000U) * ms) / 8U + 1U;
+	if (_wait_in_irq) {
+		cap = ((uint64_t)(_core_hz / 1000U) * SSD1306_PORT_IRQ_WAIT_US) / 8000ULL + 1ULL;
+		if (loops > cap) {
+			loops = (uint32_t)cap;
+		}
+	}
+	if (armed && loops > _deadline_span) {
+		loops = _deadline_span;
+	}
 
+	rc = 0;
+	spent = 0;
 	while (!ok()) {
-		if (loops-- == 0U) {
-			return -1;
+		if (spent == loops) {
+			rc = -1;
+			break;
 		}
+		spent++;
 		__NOP();
 	}
 
-	return 0;
+	if (armed) {
+		_deadline_span -= spent;
+	}
+
+	return rc;
+}
+
+/*
+ * Arm one deadline 'ms' from now for every wait until it is disarmed
+ * (ms = 0), so a flush that meets a dead bus gives up after 'ms' in
+ * total rather than after one bus timeout per byte.
+ */
+static void ssd1306_port_deadline(uint32_t ms) {
+	uint64_t span;
+
+	_deadline_armed = (uint8_t)(ms != 0U);
+	if (!_deadline_armed) {
+		return;
+	}
+
+	if (_use_dwt) {
+		span = ((uint64_t)_core_hz * (uint64_t)ms) / 1000ULL;
+		_deadline_start = DWT->CYCCNT;
+	} else {
+		span = ((uint64_t)(_core_hz / 1000U) * (uint64_t)ms) / 8U + 1U;
+	}
+
+	/* CYCCNT wraps after 2^32 cycles */
+	_deadline_span = (span > 0x7FFFFFFFULL) ? 0x7FFFFFFFUL : (uint32_t)span;
 }
 
+#ifndef SSD1306_USE_SPI
+
 /* =======================================================================
  * I2C ready-flag helpers (CMSIS bitfields)
  * ======================================================================= */
 static int ok_bus_free(void) { return ((I2Cx->SR2 & I2C_SR2_BUSY) == 0U); }
-static int ok_SB(void)       { return ((I2Cx->SR1 & I2C_SR1_SB)   != 0U); }
-static int ok_ADDR(void)     { return ((I2Cx->SR1 & I2C_SR1_ADDR) != 0U); }
-static int ok_TXE(void)      { return ((I2Cx->SR1 & I2C_SR1_TXE)  != 0U); }
-static int ok_BTF(void)      { return ((I2Cx->SR1 & I2C_SR1_BTF)  != 0U); }
+
+/* The interrupt-driven transport runs the phases below from its IRQs */
+#ifndef SSD1306_PORT_USE_IT
+
+/* Errors that end a transaction; the flag waits below return on them
+ * too, so a NACK or a bus error is reported at once */
+#define SSD1306_I2C_FAIL  (I2C_SR1_AF | I2C_SR1_BERR | I2C_SR1_ARLO)
+
+static int ok_SB(void)       { return ((I2Cx->SR1 & (I2C_SR1_SB   | SSD1306_I2C_FAIL)) != 0U); }
+static int ok_ADDR(void)     { return ((I2Cx->SR1 & (I2C_SR1_ADDR | SSD1306_I2C_FAIL)) != 0U); }
+static int ok_BTF(void)      { return ((I2Cx->SR1 & (I2C_SR1_BTF  | SSD1306_I2C_FAIL)) != 0U); }
+
+/* Wait for a flag (or an error): SSD1306_NACK, SSD1306_ERR or SSD1306_TIMEOUT */
+static ssd1306_status_t ssd1306_port_i2c_wait(int (*ok)(void)) {
+	uint32_t sr1;
+
+	if (wait_ok(ok, ssd1306_bus.timeout)) {
+		return SSD1306_TIMEOUT;
+	}
+
+	sr1 = I2Cx->SR1;
+	if ((sr1 & I2C_SR1_AF) != 0U) {
+		return SSD1306_NACK;
+	}
+	if ((sr1 & SSD1306_I2C_FAIL) != 0U) {
+		return SSD1306_ERR;
+	}
+
+	return SSD1306_OK;
+}
 
 /* =======================================================================
- * I2C write transaction
+ * I2C transaction framing
  * ======================================================================= */
 /*
- * START → address → data → STOP.
- * STOP is always generated if START was issued.
+ * START → address. Leaves ADDR set so the caller can arm the data path
+ * (polled or DMA) before clearing it. '*started' tells whether START was
+ * issued, i.e. whether a STOP is owed.
  */
-ssd1306_status_t ssd1306_port_i2c_write(const uint8_t *data, uint16_t size) {
-	ssd1306_status_t rc = SSD1306_OK;
-	uint16_t i;
-	uint32_t tmp;
-	uint8_t started = 0;
+static ssd1306_status_t ssd1306_port_i2c_begin(uint8_t *started) {
+	ssd1306_status_t rc;
+
+	*started = 0;
 
 	if (I2Cx == 0) {
 		return SSD1306_ERR;
@@ -119,27 +268,125 @@ ssd1306_status_t ssd1306_port_i2c_write(const uint8_t *data, uint16_t size) {
 		return SSD1306_ERR;
 	}
 
-	do {
-		/* Bus free? */
-		if (wait_ok(ok_bus_free, ssd1306_bus.timeout)) {
-			rc = SSD1306_BUSY;
-			break;
-		}
+	/* Bus free? */
+	if (wait_ok(ok_bus_free, ssd1306_bus.timeout)) {
+		return SSD1306_BUSY;
+	}
 
-		/* START */
-		I2Cx->CR1 |= I2C_CR1_START;
-		started = 1;
+	/* START */
+	I2Cx->CR1 |= I2C_CR1_START;
+	*started = 1;
 
-		if (wait_ok(ok_SB, ssd1306_bus.timeout)) {
-			rc = SSD1306_TIMEOUT;
-			break;
-		}
+	rc = ssd1306_port_i2c_wait(ok_SB);
+	if (rc != SSD1306_OK) {
+		return rc;
+	}
 
-		/* Address (already shifted <<1) */
-		I2Cx->DR = (uint8_t)ssd1306_bus.addr8;
+	/* Address (already shifted <<1) */
+	I2Cx->DR = (uint8_t)ssd1306_bus.addr8;
+
+	return ssd1306_port_i2c_wait(ok_ADDR);
+}
+
+/* Clear NACK / bus errors and generate STOP if START was issued */
+static void ssd1306_port_i2c_end(uint8_t started) {
+	uint32_t sr1 = I2Cx->SR1;
+
+	/* Error flags are cleared by writing 0 */
+	if ((sr1 & SSD1306_I2C_FAIL) != 0U) {
+		I2Cx->SR1 = sr1 & ~SSD1306_I2C_FAIL;
+	}
+
+	/* STOP only if we issued START and still own the bus */
+	if (started && (sr1 & I2C_SR1_ARLO) == 0U) {
+		I2Cx->CR1 |= I2C_CR1_STOP;
+	}
+}
+
+#endif /* SSD1306_PORT_USE_IT */
+
+#else /* SSD1306_USE_SPI */
+
+/* =======================================================================
+ * SPI ready-flag helpers (CMSIS bitfields)
+ * ======================================================================= */
+static int ok_idle_bus(void) { return ((SPIx->SR & (SPI_SR_TXE | SPI_SR_BSY)) == SPI_SR_TXE); }
+
+/* =======================================================================
+ * SPI transaction framing
+ * ======================================================================= */
+/*
+ * Select command or data mode from the D/C# bit of the SSD1306 control
+ * byte, then assert CS. The bus is idle here: every transaction ends
+ * with the last byte shifted out, so DC never changes under a byte.
+ */
+static ssd1306_status_t ssd1306_port_spi_begin(uint8_t control) {
+	if (SPIx == 0) {
+		return SSD1306_ERR;
+	}
+	if ((SPIx->CR1 & SPI_CR1_SPE) == 0U) {
+		return SSD1306_ERR;
+	}
+
+	ssd1306_port_pin_write(SSD1306_SPI_DC_GPIO, SSD1306_SPI_DC_PIN, (uint8_t)((control & 0x40U) != 0U));
+	ssd1306_port_pin_write(SSD1306_SPI_CS_GPIO, SSD1306_SPI_CS_PIN, 0);
+
+	return SSD1306_OK;
+}
+
+/* Wait for the last byte to leave the shift register, then release CS */
+static ssd1306_status_t ssd1306_port_spi_end(void) {
+	ssd1306_status_t rc = SSD1306_OK;
+
+	if (wait_ok(ok_idle_bus, ssd1306_bus.timeout)) {
+		rc = SSD1306_TIMEOUT;
+	}
+
+	ssd1306_port_pin_write(SSD1306_SPI_CS_GPIO, SSD1306_SPI_CS_PIN, 1);
+
+	return rc;
+}
+
+#endif /* SSD1306_USE_SPI */
+
+#ifndef SSD1306_PORT_USE_QUEUE
+
+#ifndef SSD1306_USE_SPI
+
+/* =======================================================================
+ * I2C write transaction (polled)
+ * ======================================================================= */
+
+static int ok_TXE(void)      { return ((I2Cx->SR1 & (I2C_SR1_TXE | SSD1306_I2C_FAIL)) != 0U); }
+
+/* One data byte: wait for an empty DR, then load it */
+static ssd1306_status_t ssd1306_port_i2c_put(uint8_t byte) {
+	ssd1306_status_t rc;
+
+	rc = ssd1306_port_i2c_wait(ok_TXE);
+	if (rc != SSD1306_OK) {
+		return rc;
+	}
 
-		if (wait_ok(ok_ADDR, ssd1306_bus.timeout)) {
-			rc = SSD1306_TIMEOUT;
+	I2Cx->DR = byte;
+	return SSD1306_OK;
+}
+
+/*
+ * START → address → control → segments → STOP.
+ * Bytes are taken straight from the segments, nothing is copied.
+ * STOP is always generated if START was issued.
+ */
+ssd1306_status_t ssd1306_port_writev(uint8_t control, const ssd1306_iovec_t *iov, uint8_t count) {
+	ssd1306_status_t rc;
+	uint16_t i;
+	uint8_t seg;
+	uint32_t tmp;
+	uint8_t started;
+
+	do {
+		rc = ssd1306_port_i2c_begin(&started);
+		if (rc != SSD1306_OK) {
 			break;
 		}
 
@@ -147,40 +394,888 @@ ssd1306_status_t ssd1306_port_i2c_write(const uint8_t *data, uint16_t size) {
 		tmp = I2Cx->SR1; (void)tmp;
 		tmp = I2Cx->SR2; (void)tmp;
 
+		rc = ssd1306_port_i2c_put(control);
+
 		/* Data bytes */
-		for (i = 0; i < size; i++) {
-			if (wait_ok(ok_TXE, ssd1306_bus.timeout)) {
-				rc = SSD1306_TIMEOUT;
-				break;
+		for (seg = 0; seg < count && rc == SSD1306_OK; seg++) {
+			for (i = 0; i < iov[seg].size && rc == SSD1306_OK; i++) {
+				rc = ssd1306_port_i2c_put(iov[seg].data[i]);
 			}
+		}
 
-			I2Cx->DR = data[i];
-
-			/* For last byte also wait for BTF */
-			if (i == (uint16_t)(size - 1U)) {
-				if (wait_ok(ok_BTF, ssd1306_bus.timeout)) {
-					rc = SSD1306_TIMEOUT;
-					break;
-				}
-			}
+		/* Last byte: also wait for BTF */
+		if (rc == SSD1306_OK) {
+			rc = ssd1306_port_i2c_wait(ok_BTF);
 		}
 
 	} while (0);
 
-	/* If NACK received → clear AF */
-	if ((I2Cx->SR1 & I2C_SR1_AF) != 0U) {
-		I2Cx->SR1 &= (uint16_t)~I2C_SR1_AF;
+	if (I2Cx != 0) {
+		ssd1306_port_i2c_end(started);
 	}
 
-	/* STOP only if we issued START */
-	if (started) {
-		I2Cx->CR1 |= I2C_CR1_STOP;
+	return rc;
+}
+
+#else /* SSD1306_USE_SPI */
+
+/* =======================================================================
+ * SPI write transaction (polled)
+ * ======================================================================= */
+
+static int ok_TXE(void)      { return ((SPIx->SR & SPI_SR_TXE) != 0U); }
+
+/* One data byte: wait for an empty DR, then load it */
+static ssd1306_status_t ssd1306_port_spi_put(uint8_t byte) {
+	if (wait_ok(ok_TXE, ssd1306_bus.timeout)) {
+		return SSD1306_TIMEOUT;
+	}
+
+	SPIx->DR = byte;
+	return SSD1306_OK;
+}
+
+/*
+ * DC, CS low → segments → CS high once the last byte is out.
+ * Bytes are taken straight from the segments, nothing is copied.
+ */
+ssd1306_status_t ssd1306_port_writev(uint8_t control, const ssd1306_iovec_t *iov, uint8_t count) {
+	ssd1306_status_t rc;
+	ssd1306_status_t rc_end;
+	uint16_t i;
+	uint8_t seg;
+
+	rc = ssd1306_port_spi_begin(control);
+	if (rc != SSD1306_OK) {
+		return rc;
+	}
+
+	for (seg = 0; seg < count && rc == SSD1306_OK; seg++) {
+		for (i = 0; i < iov[seg].size && rc == SSD1306_OK; i++) {
+			rc = ssd1306_port_spi_put(iov[seg].data[i]);
+		}
+	}
+
+	rc_end = ssd1306_port_spi_end();
+
+	return (rc != SSD1306_OK) ? rc : rc_end;
+}
+
+#endif /* SSD1306_USE_SPI */
+
+#else /* SSD1306_PORT_USE_QUEUE */
+
+/* =======================================================================
+ * Queued write transactions (DMA or I2C interrupts)
+ * ======================================================================= */
+/*
+ * Every transaction is copied into a byte queue and sent in the
+ * background, one after another: over DMA the payload is moved by the
+ * DMA channel, and its transfer-complete interrupt finishes the
+ * transaction and starts the next queued one; with SSD1306_PORT_USE_IT
+ * the I2C event interrupt walks each transaction through its bus phases
+ * byte by byte. Callers only wait when the queue is full.
+ *
+ * ssd1306_port_writev_stable() queues only the control byte and leaves
+ * the payload where it is: the caller keeps it unchanged until the queue
+ * has drained (the front frame of SSD1306_DOUBLE_BUFFER).
+ *
+ * The queue is single-producer (thread mode) / single-consumer (IRQ):
+ * the producer only advances q_head, the IRQ only advances q_tail and
+ * clears q_busy after seeing an empty queue, so no critical section is
+ * needed on a single core.
+ */
+
+#if (SSD1306_PORT_QUEUE_BYTES < 129)
+#error "SSD1306_PORT_QUEUE_BYTES must hold at least one 128-byte page row plus its control byte"
+#endif
+
+typedef struct {
+	uint16_t start; /* offset in ssd1306_q_data, control byte first */
+	uint16_t size;  /* control byte included */
+	const uint8_t *data; /* payload: after the control byte, or in place */
+} ssd1306_q_pkt_t;
+
+static uint8_t ssd1306_q_data[SSD1306_PORT_QUEUE_BYTES];
+static ssd1306_q_pkt_t ssd1306_q_pkt[SSD1306_PORT_QUEUE_DEPTH];
+static volatile uint16_t ssd1306_q_head;   /* packets queued (producer) */
+static volatile uint16_t ssd1306_q_tail;   /* packets sent (IRQ) */
+static uint16_t ssd1306_q_wpos;            /* next free byte (producer) */
+static volatile uint8_t ssd1306_q_busy;    /* a transaction is in flight */
+static volatile ssd1306_status_t ssd1306_q_status;  /* first error of the batch */
+static ssd1306_status_t ssd1306_q_error;   /* first error not yet reported */
+
+static ssd1306_port_start_cb_t ssd1306_q_on_start;
+static ssd1306_port_complete_cb_t ssd1306_q_on_complete;
+static void *ssd1306_q_cb_ctx;
+
+/* Requested packet size, for ok_queue_space() */
+static uint16_t ssd1306_q_need;
+
+#ifdef SSD1306_PORT_USE_DMA
+
+/* DMA interrupt flags of the configured channel */
+#define SSD1306_DMA_FLAG_SHIFT  (4U * (SSD1306_PORT_DMA_CHANNEL_NUM - 1U))
+#define SSD1306_DMA_FLAG_GIF    (0x1UL << SSD1306_DMA_FLAG_SHIFT)
+#define SSD1306_DMA_FLAG_TCIF   (0x2UL << SSD1306_DMA_FLAG_SHIFT)
+#define SSD1306_DMA_FLAG_TEIF   (0x8UL << SSD1306_DMA_FLAG_SHIFT)
+
+#define DMAx_CH (SSD1306_PORT_DMA_CHANNEL)
+
+/* Point the channel at 'count' bytes from 'mem' to the data register */
+static void ssd1306_dma_arm(volatile uint32_t *dr, const uint8_t *mem, uint16_t count) {
+	DMAx_CH->CCR &= ~DMA_CCR_EN;
+	SSD1306_PORT_DMA->IFCR = SSD1306_DMA_FLAG_GIF;
+	DMAx_CH->CPAR = (uintptr_t)dr;
+	DMAx_CH->CMAR = (uintptr_t)mem;
+	DMAx_CH->CNDTR = count;
+	DMAx_CH->CCR = DMA_CCR_MINC | DMA_CCR_DIR | DMA_CCR_TCIE | DMA_CCR_TEIE | DMA_CCR_EN;
+}
+
+#ifndef SSD1306_USE_SPI
+
+static uint8_t ssd1306_dma_started;
+
+/* START → address, then hand control byte and payload to the channel */
+static ssd1306_status_t ssd1306_q_begin(const ssd1306_q_pkt_t *pkt) {
+	ssd1306_status_t rc;
+	uint32_t tmp;
+
+	rc = ssd1306_port_i2c_begin(&ssd1306_dma_started);
+	if (rc != SSD1306_OK) {
+		if (I2Cx != 0) {
+			ssd1306_port_i2c_end(ssd1306_dma_started);
+		}
+		return rc;
+	}
+
+	if (pkt->data == &ssd1306_q_data[pkt->start + 1U]) {
+		/* Arm the channel, then let TXE requests flow by clearing ADDR */
+		ssd1306_dma_arm(&I2Cx->DR, &ssd1306_q_data[pkt->start], pkt->size);
+		I2Cx->CR2 |= I2C_CR2_DMAEN;
+
+		tmp = I2Cx->SR1; (void)tmp;
+		tmp = I2Cx->SR2; (void)tmp;
+
+		return SSD1306_OK;
+	}
+
+	/* Payload sent in place: the control byte goes into DR by hand
+	 * (EV8_1, DR empty after ADDR), the channel does the rest */
+	ssd1306_dma_arm(&I2Cx->DR, pkt->data, (uint16_t)(pkt->size - 1U));
+
+	tmp = I2Cx->SR1; (void)tmp;
+	tmp = I2Cx->SR2; (void)tmp;
+
+	I2Cx->DR = ssd1306_q_data[pkt->start];
+	I2Cx->CR2 |= I2C_CR2_DMAEN;
+
+	return SSD1306_OK;
+}
+
+/* Channel done: wait for the last byte unless it failed, then STOP */
+static ssd1306_status_t ssd1306_dma_finish(uint8_t transferred) {
+	ssd1306_status_t rc = SSD1306_OK;
+
+	I2Cx->CR2 &= ~I2C_CR2_DMAEN;
+
+	if (transferred) {
+		/* Last byte still on the wire, or NACKed */
+		rc = ssd1306_port_i2c_wait(ok_BTF);
+	}
+
+	ssd1306_port_i2c_end(ssd1306_dma_started);
+
+	return rc;
+}
+
+#else /* SSD1306_USE_SPI */
+
+/* DC from the control byte, CS low, then hand the payload to the channel */
+static ssd1306_status_t ssd1306_q_begin(const ssd1306_q_pkt_t *pkt) {
+	ssd1306_status_t rc;
+
+	rc = ssd1306_port_spi_begin(ssd1306_q_data[pkt->start]);
+	if (rc != SSD1306_OK) {
+		return rc;
+	}
+
+	ssd1306_dma_arm(&SPIx->DR, pkt->data, (uint16_t)(pkt->size - 1U));
+	SPIx->CR2 |= SPI_CR2_TXDMAEN;
+
+	return SSD1306_OK;
+}
+
+/* Channel done: the last byte may still be shifting out */
+static ssd1306_status_t ssd1306_dma_finish(uint8_t transferred) {
+	(void)transferred;
+
+	SPIx->CR2 &= ~SPI_CR2_TXDMAEN;
+
+	return ssd1306_port_spi_end();
+}
+
+#endif /* SSD1306_USE_SPI */
+
+#else /* SSD1306_PORT_USE_IT */
+
+/* Transaction in flight and its next byte to load into DR (0: the
+ * control byte) */
+static const ssd1306_q_pkt_t *ssd1306_it_pkt;
+static volatile uint16_t ssd1306_it_pos;
+static uint16_t ssd1306_it_end;
+
+#define SSD1306_IT_EVENTS  (I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN)
+#define SSD1306_IT_ERRORS  (I2C_SR1_AF | I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_OVR | I2C_SR1_TIMEOUT)
+
+/*
+ * Request START and let the event interrupt take it from there:
+ * SB → address, ADDR → TXE per byte → BTF → STOP. A STOP requested by
+ * the previous transaction frees the bus within a few bit times.
+ */
+static ssd1306_status_t ssd1306_q_begin(const ssd1306_q_pkt_t *pkt) {
+	if (I2Cx == 0) {
+		return SSD1306_ERR;
+	}
+	if ((I2Cx->CR1 & I2C_CR1_PE) == 0U) {
+		return SSD1306_ERR;
+	}
+
+	if (wait_ok(ok_bus_free, ssd1306_bus.timeout)) {
+		return SSD1306_BUSY;
+	}
+
+	ssd1306_it_pkt = pkt;
+	ssd1306_it_pos = 0;
+	ssd1306_it_end = pkt->size;
+
+	I2Cx->CR2 = (I2Cx->CR2 & ~SSD1306_IT_EVENTS) | I2C_CR2_ITEVTEN | I2C_CR2_ITERREN;
+	I2Cx->CR1 |= I2C_CR1_START;
+
+	return SSD1306_OK;
+}
+
+#endif /* SSD1306_PORT_USE_DMA */
+
+void ssd1306_port_set_callbacks(ssd1306_port_start_cb_t on_start,
+                                ssd1306_port_complete_cb_t on_complete,
+                                void *ctx) {
+	ssd1306_q_on_start = on_start;
+	ssd1306_q_on_complete = on_complete;
+	ssd1306_q_cb_ctx = ctx;
+}
+
+uint8_t ssd1306_port_busy(void) {
+	return ssd1306_q_busy;
+}
+
+static int ok_idle(void) { return (ssd1306_q_busy == 0U); }
+
+ssd1306_status_t ssd1306_port_wait_idle(void) {
+	ssd1306_status_t rc;
+
+	if (wait_ok(ok_idle, ssd1306_bus.timeout)) {
+		return SSD1306_TIMEOUT;
 	}
 
+	/* Idle: the IRQ no longer touches it */
+	rc = ssd1306_q_error;
+	ssd1306_q_error = SSD1306_OK;
+
 	return rc;
 }
 
+/*
+ * Offset where a packet of 'size' bytes fits in the byte queue, or -1.
+ * Space behind the oldest queued packet is reused once the write
+ * position has wrapped; a packet never straddles the end.
+ */
+static int32_t ssd1306_q_fit(uint16_t size) {
+	uint16_t tail;
+	uint16_t oldest;
+
+	tail = ssd1306_q_tail;
+	if ((uint16_t)(ssd1306_q_head - tail) >= SSD1306_PORT_QUEUE_DEPTH) {
+		return -1;
+	}
+
+	if (ssd1306_q_head == tail) {
+		/* Empty and idle: restart from the beginning */
+		return (size <= SSD1306_PORT_QUEUE_BYTES) ? 0 : -1;
+	}
+
+	oldest = ssd1306_q_pkt[tail % SSD1306_PORT_QUEUE_DEPTH].start;
+
+	if (ssd1306_q_wpos > oldest) {
+		/* Not wrapped: free space at the end, then at the front */
+		if (size <= (uint16_t)(SSD1306_PORT_QUEUE_BYTES - ssd1306_q_wpos)) {
+			return ssd1306_q_wpos;
+		}
+		return (size <= oldest) ? 0 : -1;
+	}
+
+	/* Wrapped: free space up to the oldest packet */
+	return (size <= (uint16_t)(oldest - ssd1306_q_wpos)) ? ssd1306_q_wpos : -1;
+}
+
+static int ok_queue_space(void) { return (ssd1306_q_fit(ssd1306_q_need) >= 0); }
+
+/* Start the oldest queued transaction (thread mode or IRQ) */
+static void ssd1306_q_start_next(void) {
+	const ssd1306_q_pkt_t *pkt;
+	ssd1306_status_t rc;
+
+	while (ssd1306_q_tail != ssd1306_q_head) {
+		pkt = &ssd1306_q_pkt[ssd1306_q_tail % SSD1306_PORT_QUEUE_DEPTH];
+
+		rc = ssd1306_q_begin(pkt);
+		if (rc == SSD1306_OK) {
+			return;
+		}
+
+		/* Could not even address the display: drop this transaction.
+		 * A NACK comes back within an address time, but after a
+		 * timeout in an interrupt drop the whole batch rather than
+		 * wait on each one in turn */
+		if (ssd1306_q_status == SSD1306_OK) {
+			ssd1306_q_status = rc;
+		}
+		if (_wait_in_irq && rc != SSD1306_NACK) {
+			ssd1306_q_tail = ssd1306_q_head;
+		} else {
+			ssd1306_q_tail++;
+		}
+	}
+
+	if (ssd1306_q_error == SSD1306_OK) {
+		ssd1306_q_error = ssd1306_q_status;
+	}
+	ssd1306_q_busy = 0;
+	if (ssd1306_q_on_complete) {
+		ssd1306_q_on_complete(ssd1306_q_status, ssd1306_q_cb_ctx);
+	}
+}
+
+/* The transaction in flight has ended (IRQ): move on to the next one */
+static void ssd1306_q_done(ssd1306_status_t rc) {
+	if (rc != SSD1306_OK && ssd1306_q_status == SSD1306_OK) {
+		ssd1306_q_status = rc;
+	}
+
+	ssd1306_q_tail++;
+
+	_wait_in_irq = 1;
+	ssd1306_q_start_next();
+	_wait_in_irq = 0;
+}
+
+/* Stop the transaction in flight and drop everything queued */
+static void ssd1306_q_abort(void) {
+#ifdef SSD1306_PORT_USE_DMA
+	DMAx_CH->CCR &= ~DMA_CCR_EN;
+	SSD1306_PORT_DMA->IFCR = SSD1306_DMA_FLAG_GIF;
+#ifdef SSD1306_USE_SPI
+	SPIx->CR2 &= ~SPI_CR2_TXDMAEN;
+#else
+	I2Cx->CR2 &= ~I2C_CR2_DMAEN;
+#endif
+#else
+	I2Cx->CR2 &= ~SSD1306_IT_EVENTS;
+#endif
+
+	ssd1306_q_tail = ssd1306_q_head;
+	ssd1306_q_busy = 0;
+	ssd1306_q_status = SSD1306_OK;
+	ssd1306_q_error = SSD1306_OK;
+}
+
+#ifdef SSD1306_PORT_USE_DMA
+
+void ssd1306_port_dma_irq_handler(void) {
+	uint32_t isr = SSD1306_PORT_DMA->ISR;
+	ssd1306_status_t rc;
+
+	if ((isr & (SSD1306_DMA_FLAG_TCIF | SSD1306_DMA_FLAG_TEIF)) == 0U) {
+		return;
+	}
+
+	SSD1306_PORT_DMA->IFCR = SSD1306_DMA_FLAG_GIF;
+	DMAx_CH->CCR &= ~DMA_CCR_EN;
+
+	_wait_in_irq = 1;
+	rc = ssd1306_dma_finish((uint8_t)((isr & SSD1306_DMA_FLAG_TEIF) == 0U));
+	if ((isr & SSD1306_DMA_FLAG_TEIF) != 0U) {
+		rc = SSD1306_ERR;
+	}
+
+	ssd1306_q_done(rc);
+}
+
+#else /* SSD1306_PORT_USE_IT */
+
+void ssd1306_port_i2c_ev_irq_handler(void) {
+	uint32_t sr1 = I2Cx->SR1;
+	uint32_t tmp;
+
+	if ((sr1 & I2C_SR1_SB) != 0U) {
+		/* EV5: SR1 read above, writing DR clears SB */
+		I2Cx->DR = (uint8_t)ssd1306_bus.addr8;
+		return;
+	}
+
+	if ((sr1 & I2C_SR1_ADDR) != 0U) {
+		/* EV6: clear ADDR by reading SR2, then feed DR on TXE */
+		tmp = I2Cx->SR2; (void)tmp;
+		I2Cx->CR2 |= I2C_CR2_ITBUFEN;
+		return;
+	}
+
+	if ((sr1 & I2C_SR1_TXE) != 0U && ssd1306_it_pos != ssd1306_it_end) {
+		/* EV8: next byte; after the last one only BTF is of interest */
+		I2Cx->DR = (ssd1306_it_pos == 0U) ? ssd1306_q_data[ssd1306_it_pkt->start]
+		                                  : ssd1306_it_pkt->data[ssd1306_it_pos - 1U];
+		ssd1306_it_pos++;
+		if (ssd1306_it_pos == ssd1306_it_end) {
+			I2Cx->CR2 &= ~I2C_CR2_ITBUFEN;
+		}
+		return;
+	}
+
+	if ((sr1 & I2C_SR1_BTF) != 0U && ssd1306_it_pos == ssd1306_it_end) {
+		/* EV8_2: last byte acknowledged */
+		I2Cx->CR2 &= ~SSD1306_IT_EVENTS;
+		I2Cx->CR1 |= I2C_CR1_STOP;
+		ssd1306_q_done(SSD1306_OK);
+	}
+}
+
+void ssd1306_port_i2c_er_irq_handler(void) {
+	uint32_t sr1 = I2Cx->SR1;
+
+	if ((sr1 & SSD1306_IT_ERRORS) == 0U) {
+		return;
+	}
+
+	/* Error flags are cleared by writing 0 */
+	I2Cx->SR1 = sr1 & ~SSD1306_IT_ERRORS;
+	I2Cx->CR2 &= ~SSD1306_IT_EVENTS;
+
+	/* After lost arbitration the bus belongs to the other master */
+	if ((sr1 & I2C_SR1_ARLO) == 0U) {
+		I2Cx->CR1 |= I2C_CR1_STOP;
+	}
+
+	ssd1306_q_done(((sr1 & I2C_SR1_AF) != 0U) ? SSD1306_NACK : SSD1306_ERR);
+}
+
+#endif /* SSD1306_PORT_USE_DMA */
+
+/* Wait (up to the bus timeout) for 'size' bytes of queue space */
+static int32_t ssd1306_q_reserve(uint16_t size) {
+	ssd1306_q_need = size;
+	if (wait_ok(ok_queue_space, ssd1306_bus.timeout)) {
+		return -1;
+	}
+
+	return ssd1306_q_fit(size);
+}
+
+/* Publish a packet written at 'at' and start it when the transport is idle */
+static void ssd1306_q_push(uint16_t at, uint16_t used, uint16_t size, const uint8_t *data) {
+	ssd1306_q_pkt_t *pkt;
+
+	pkt = &ssd1306_q_pkt[ssd1306_q_head % SSD1306_PORT_QUEUE_DEPTH];
+	pkt->start = at;
+	pkt->size = size;
+	pkt->data = data;
+	ssd1306_q_wpos = (uint16_t)(at + used);
+
+	/* Publish the packet before looking at q_busy (see above) */
+	ssd1306_q_head++;
+
+	if (!ssd1306_q_busy) {
+		ssd1306_q_busy = 1;
+		ssd1306_q_status = SSD1306_OK;
+		if (ssd1306_q_on_start) {
+			ssd1306_q_on_start(ssd1306_q_cb_ctx);
+		}
+		ssd1306_q_start_next();
+	}
+}
+
+/*
+ * Queue one transaction and return; it is started right away when the
+ * transport is idle. The segments are gathered into the queue, since the
+ * caller may change them as soon as this returns. Waits (up to the bus
+ * timeout) only for queue space.
+ */
+ssd1306_status_t ssd1306_port_writev(uint8_t control, const ssd1306_iovec_t *iov, uint8_t count) {
+	int32_t at;
+	uint32_t size = 1U;
+	uint16_t i;
+	uint8_t seg;
+	uint8_t *dst;
+
+	for (seg = 0; seg < count; seg++) {
+		size += iov[seg].size;
+	}
+
+#ifdef SSD1306_USE_SPI
+	if (SPIx == 0 || size > SSD1306_PORT_QUEUE_BYTES) {
+		return SSD1306_ERR;
+	}
+	if (size == 1U) {
+		/* Nothing to clock out over SPI */
+		return SSD1306_OK;
+	}
+#else
+	if (I2Cx == 0 || size > SSD1306_PORT_QUEUE_BYTES) {
+		return SSD1306_ERR;
+	}
+#endif
+
+	at = ssd1306_q_reserve((uint16_t)size);
+	if (at < 0) {
+		return SSD1306_BUSY;
+	}
+
+	dst = &ssd1306_q_data[at];
+	*dst++ = control;
+	for (seg = 0; seg < count; seg++) {
+		for (i = 0; i < iov[seg].size; i++) {
+			*dst++ = iov[seg].data[i];
+		}
+	}
+	ssd1306_q_push((uint16_t)at, (uint16_t)size, (uint16_t)size, &ssd1306_q_data[at + 1]);
+
+	return SSD1306_OK;
+}
+
+/*
+ * Queue one transaction whose segments stay unchanged until the queue
+ * has drained. Segments that follow each other in memory go out in place
+ * from where they are, only the control byte takes queue space; others
+ * are copied as by ssd1306_port_writev().
+ */
+ssd1306_status_t ssd1306_port_writev_stable(uint8_t control, const ssd1306_iovec_t *iov, uint8_t count) {
+	int32_t at;
+	uint32_t size;
+	uint8_t seg;
+
+	size = 1U;
+	for (seg = 0; seg < count; seg++) {
+		if (seg > 0U && iov[seg].data != iov[seg - 1U].data + iov[seg - 1U].size) {
+			return ssd1306_port_writev(control, iov, count);
+		}
+		size += iov[seg].size;
+	}
+	if (size == 1U || size > 0xFFFFU) {
+		return ssd1306_port_writev(control, iov, count);
+	}
+
+#ifdef SSD1306_USE_SPI
+	if (SPIx == 0) {
+		return SSD1306_ERR;
+	}
+#else
+	if (I2Cx == 0) {
+		return SSD1306_ERR;
+	}
+#endif
+
+	at = ssd1306_q_reserve(1U);
+	if (at < 0) {
+		return SSD1306_BUSY;
+	}
+
+	ssd1306_q_data[at] = control;
+	ssd1306_q_push((uint16_t)at, 1U, (uint16_t)size, iov[0].data);
+
+	return SSD1306_OK;
+}
+
+#endif /* SSD1306_PORT_USE_QUEUE */
+
+/* =======================================================================
+ * Bus recovery
+ * ======================================================================= */
+
+#ifndef SSD1306_USE_SPI
+
+#ifdef SSD1306_I2C_SCL_GPIO
+
+/* Busy-wait for a few microseconds (bit timing of the bus clear) */
+static void ssd1306_port_delay_us(uint32_t us) {
+	uint32_t start;
+	uint32_t cycles = (_core_hz / 1000000U) * us;
+
+	if (_use_dwt) {
+		start = DWT->CYCCNT;
+		while ((uint32_t)(DWT->CYCCNT - start) < cycles) {
+		}
+		return;
+	}
+
+	/* Factor 4 ≈ cycles per loop */
+	for (cycles = cycles / 4U + 1U; cycles != 0U; cycles--) {
+		__NOP();
+	}
+}
+
+/* Take a pin from the I2C peripheral as an open-drain output; returns
+ * its configuration for ssd1306_port_pin_restore() */
+static uint32_t ssd1306_port_pin_to_gpio(GPIO_TypeDef *gpio, uint8_t pin) {
+#if defined(SSD1306_MCU_STM32F1)
+	volatile uint32_t *cr = (pin < 8U) ? &gpio->CRL : &gpio->CRH;
+	uint32_t shift = (uint32_t)(pin & 7U) * 4U;
+	uint32_t old = *cr;
+
+	/* CNF = 01 (general purpose open-drain), MODE = 11 (50 MHz) */
+	*cr = (old & ~(0xFUL << shift)) | (0x7UL << shift);
+	return (old >> shift) & 0xFUL;
+#else
+	uint32_t shift = (uint32_t)pin * 2U;
+	uint32_t old = (gpio->MODER >> shift) & 0x3UL;
+
+	gpio->OTYPER |= (1UL << pin);
+	gpio->MODER = (gpio->MODER & ~(0x3UL << shift)) | (0x1UL << shift);
+	return old;
+#endif
+}
+
+static void ssd1306_port_pin_restore(GPIO_TypeDef *gpio, uint8_t pin, uint32_t cfg) {
+#if defined(SSD1306_MCU_STM32F1)
+	volatile uint32_t *cr = (pin < 8U) ? &gpio->CRL : &gpio->CRH;
+	uint32_t shift = (uint32_t)(pin & 7U) * 4U;
+
+	*cr = (*cr & ~(0xFUL << shift)) | (cfg << shift);
+#else
+	uint32_t shift = (uint32_t)pin * 2U;
+
+	gpio->MODER = (gpio->MODER & ~(0x3UL << shift)) | (cfg << shift);
+#endif
+}
+
+/*
+ * Bus clear: a slave stopped in the middle of a byte holds SDA low until
+ * it has clocked the rest of it out. Up to nine SCL pulses let it
+ * finish, then a STOP returns the bus to idle. About 100 kHz.
+ */
+static void ssd1306_port_i2c_unstick(void) {
+	uint32_t scl_cfg;
+	uint32_t sda_cfg;
+	uint8_t pulses;
+
+	/* Released (high) before the pins leave the peripheral */
+	ssd1306_port_pin_write(SSD1306_I2C_SCL_GPIO, SSD1306_I2C_SCL_PIN, 1);
+	ssd1306_port_pin_write(SSD1306_I2C_SDA_GPIO, SSD1306_I2C_SDA_PIN, 1);
+	scl_cfg = ssd1306_port_pin_to_gpio(SSD1306_I2C_SCL_GPIO, SSD1306_I2C_SCL_PIN);
+	sda_cfg = ssd1306_port_pin_to_gpio(SSD1306_I2C_SDA_GPIO, SSD1306_I2C_SDA_PIN);
+	ssd1306_port_delay_us(5);
+
+	for (pulses = 0; pulses < 9U; pulses++) {
+		if ((SSD1306_I2C_SDA_GPIO->IDR & (1UL << SSD1306_I2C_SDA_PIN)) != 0U) {
+			break;
+		}
+		ssd1306_port_pin_write(SSD1306_I2C_SCL_GPIO, SSD1306_I2C_SCL_PIN, 0);
+		ssd1306_port_delay_us(5);
+		ssd1306_port_pin_write(SSD1306_I2C_SCL_GPIO, SSD1306_I2C_SCL_PIN, 1);
+		ssd1306_port_delay_us(5);
+	}
+
+	/* STOP: SDA rises while SCL is high */
+	ssd1306_port_pin_write(SSD1306_I2C_SCL_GPIO, SSD1306_I2C_SCL_PIN, 0);
+	ssd1306_port_delay_us(5);
+	ssd1306_port_pin_write(SSD1306_I2C_SDA_GPIO, SSD1306_I2C_SDA_PIN, 0);
+	ssd1306_port_delay_us(5);
+	ssd1306_port_pin_write(SSD1306_I2C_SCL_GPIO, SSD1306_I2C_SCL_PIN, 1);
+	ssd1306_port_delay_us(5);
+	ssd1306_port_pin_write(SSD1306_I2C_SDA_GPIO, SSD1306_I2C_SDA_PIN, 1);
+	ssd1306_port_delay_us(5);
+
+	ssd1306_port_pin_restore(SSD1306_I2C_SDA_GPIO, SSD1306_I2C_SDA_PIN, sda_cfg);
+	ssd1306_port_pin_restore(SSD1306_I2C_SCL_GPIO, SSD1306_I2C_SCL_PIN, scl_cfg);
+}
+
+#endif /* SSD1306_I2C_SCL_GPIO */
+
+/*
+ * Drop queued transactions, clear the bus if SDA is held low (with
+ * SSD1306_I2C_SCL_GPIO), then reset the peripheral, which can itself be
+ * stuck with BUSY set, and program it again as it was.
+ */
+ssd1306_status_t ssd1306_port_recover(void) {
+	uint32_t cr1;
+	uint32_t cr2;
+	uint32_t oar1;
+	uint32_t ccr;
+	uint32_t trise;
+
+	if (I2Cx == 0) {
+		return SSD1306_ERR;
+	}
+
+#ifdef SSD1306_PORT_USE_QUEUE
+	ssd1306_q_abort();
+#endif
+
+	cr1   = I2Cx->CR1 & ~(I2C_CR1_START | I2C_CR1_STOP | I2C_CR1_SWRST);
+	cr2   = I2Cx->CR2 & ~(I2C_CR2_DMAEN | I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN);
+	oar1  = I2Cx->OAR1;
+	ccr   = I2Cx->CCR;
+	trise = I2Cx->TRISE;
+
+	I2Cx->CR1 &= ~I2C_CR1_PE;
+
+#ifdef SSD1306_I2C_SCL_GPIO
+	ssd1306_port_i2c_unstick();
+#endif
+
+	I2Cx->CR1   = I2C_CR1_SWRST;
+	I2Cx->CR1   = 0U;
+	I2Cx->CR2   = cr2;
+	I2Cx->OAR1  = oar1;
+	I2Cx->CCR   = ccr;
+	I2Cx->TRISE = trise;
+	I2Cx->CR1   = cr1;
+
+	return ok_bus_free() ? SSD1306_OK : SSD1306_BUSY;
+}
+
+#else /* SSD1306_USE_SPI */
+
+/* Drop queued transactions, deselect, and reset the controller through
+ * RST when it is wired */
+ssd1306_status_t ssd1306_port_recover(void) {
+	if (SPIx == 0) {
+		return SSD1306_ERR;
+	}
+
+#ifdef SSD1306_PORT_USE_QUEUE
+	ssd1306_q_abort();
+#endif
+
+	ssd1306_port_pin_write(SSD1306_SPI_CS_GPIO, SSD1306_SPI_CS_PIN, 1);
+	ssd1306_port_spi_reset();
+
+	return SSD1306_OK;
+}
+
+#endif /* SSD1306_USE_SPI */
+
+/* Raw packet: first byte is the control byte */
+ssd1306_status_t ssd1306_port_write(const uint8_t *data, uint16_t size) {
+	ssd1306_iovec_t iov;
+
+	if (size == 0U) {
+		return SSD1306_ERR;
+	}
+
+	iov.data = &data[1];
+	iov.size = (uint16_t)(size - 1U);
+
+	return ssd1306_port_writev(data[0], &iov, 1);
+}
+
 /* Watchdog hook (platform-dependent, intentionally empty here) */
 void ssd1306_port_watchdog_feed(void) {
 	;
 }
+
+/* =======================================================================
+ * Transport interface
+ * ======================================================================= */
+
+static ssd1306_status_t ssd1306_port_tr_init(void *ctx) {
+	(void)ctx;
+
+	SystemCoreClockUpdate();
+	ssd1306_time_init(SystemCoreClock);
+	SSD1306_PORT_SETUP_DEFAULT();
+
+	return SSD1306_OK;
+}
+
+static ssd1306_status_t ssd1306_port_tr_write(void *ctx, const ssd1306_iovec_t *iov, uint8_t count) {
+	(void)ctx;
+
+	/* Co=0, D/C#=1: every following byte is a data byte */
+	return ssd1306_port_writev(0x40, iov, count);
+}
+
+static ssd1306_status_t ssd1306_port_tr_write_cmds(void *ctx, const uint8_t *cmds, uint16_t count) {
+	ssd1306_iovec_t iov;
+
+	(void)ctx;
+	iov.data = cmds;
+	iov.size = count;
+
+	/* Co=0, D/C#=0: every following byte is a command byte */
+	return ssd1306_port_writev(0x00, &iov, 1);
+}
+
+static void ssd1306_port_tr_flush_begin(void *ctx, uint32_t timeout_ms) {
+	(void)ctx;
+
+	ssd1306_port_deadline(timeout_ms);
+}
+
+static void ssd1306_port_tr_flush_complete(void *ctx) {
+	(void)ctx;
+
+	ssd1306_port_deadline(0);
+}
+
+static ssd1306_status_t ssd1306_port_tr_recover(void *ctx) {
+	(void)ctx;
+
+	return ssd1306_port_recover();
+}
+
+#ifdef SSD1306_PORT_USE_QUEUE
+
+static uint8_t ssd1306_port_tr_busy(void *ctx) {
+	(void)ctx;
+
+	return ssd1306_port_busy();
+}
+
+static ssd1306_status_t ssd1306_port_tr_wait_idle(void *ctx) {
+	(void)ctx;
+
+	return ssd1306_port_wait_idle();
+}
+
+static ssd1306_status_t ssd1306_port_tr_write_stable(void *ctx, const ssd1306_iovec_t *iov, uint8_t count) {
+	(void)ctx;
+
+	return ssd1306_port_writev_stable(0x40, iov, count);
+}
+
+#endif
+
+const ssd1306_transport_t ssd1306_transport_stm32 = {
+	ssd1306_port_tr_init,
+	ssd1306_port_tr_write,
+	ssd1306_port_tr_write_cmds,
+	ssd1306_port_tr_flush_begin,
+	ssd1306_port_tr_flush_complete,
+#ifdef SSD1306_PORT_USE_QUEUE
+	ssd1306_port_tr_busy,
+	ssd1306_port_tr_wait_idle,
+#else
+	NULL,
+	NULL,
+#endif
+	ssd1306_port_tr_recover,
+	NULL,
+	SSD1306_PORT_TX_OVERHEAD,
+#ifdef SSD1306_PORT_USE_QUEUE
+	ssd1306_port_tr_write_stable,
+#else
+	NULL,
+#endif
+	SSD1306_PORT_TX_COST
+};
+
+#endif /* SSD1306_MCU_HOST */
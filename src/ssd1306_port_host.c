@@ -0,0 +1,166 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Даниил Еремеев
+ * See LICENSE file for details.
+ */
+
+/*
+ * ssd1306_port_host.c
+ * Host (POSIX) backend: records every transaction to a file or pipe
+ * instead of driving a bus, and provides the timing hooks.
+ */
+
+#ifdef SSD1306_MCU_HOST
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stddef.h>
+#include <time.h>
+#include "ssd1306_port_host.h"
+
+ssd1306_host_t ssd1306_host;
+
+/* =======================================================================
+ * Recording
+ * ======================================================================= */
+
+static ssd1306_status_t ssd1306_host_record(ssd1306_host_t *host, uint8_t control,
+                                            const ssd1306_iovec_t *iov, uint8_t count) {
+	uint8_t header[3];
+	uint32_t size;
+	uint8_t seg;
+
+	size = 0;
+	for (seg = 0; seg < count; seg++) {
+		size += iov[seg].size;
+	}
+	if (size > 0xFFFFU) {
+		return SSD1306_ERR;
+	}
+	if (host->offline && control != SSD1306_HOST_REC_FLUSH) {
+		/* Nobody acknowledges the address */
+		return SSD1306_ERR;
+	}
+
+	if (control != SSD1306_HOST_REC_FLUSH) {
+		host->transactions++;
+		host->bytes += size;
+	}
+
+	if (host->out == NULL) {
+		return SSD1306_OK;
+	}
+
+	header[0] = control;
+	header[1] = (uint8_t)size;
+	header[2] = (uint8_t)(size >> 8);
+	if (fwrite(header, 1, sizeof(header), host->out) != sizeof(header)) {
+		goto fail;
+	}
+	for (seg = 0; seg < count; seg++) {
+		if (iov[seg].size != 0U &&
+		    fwrite(iov[seg].data, 1, iov[seg].size, host->out) != iov[seg].size) {
+			goto fail;
+		}
+	}
+
+	return SSD1306_OK;
+
+fail:
+	if (host->status == SSD1306_OK) {
+		host->status = SSD1306_ERR;
+	}
+	return SSD1306_ERR;
+}
+
+/* =======================================================================
+ * Transport interface
+ * ======================================================================= */
+
+static ssd1306_status_t ssd1306_host_tr_write(void *ctx, const ssd1306_iovec_t *iov, uint8_t count) {
+	return ssd1306_host_record((ssd1306_host_t *)ctx, SSD1306_HOST_REC_DATA, iov, count);
+}
+
+static ssd1306_status_t ssd1306_host_tr_write_cmds(void *ctx, const uint8_t *cmds, uint16_t count) {
+	ssd1306_iovec_t iov;
+
+	iov.data = cmds;
+	iov.size = count;
+
+	return ssd1306_host_record((ssd1306_host_t *)ctx, SSD1306_HOST_REC_COMMANDS, &iov, 1);
+}
+
+static void ssd1306_host_tr_flush_complete(void *ctx) {
+	ssd1306_host_t *host = (ssd1306_host_t *)ctx;
+
+	host->flushes++;
+	(void)ssd1306_host_record(host, SSD1306_HOST_REC_FLUSH, NULL, 0);
+
+	/* A reader at the other end of a pipe sees whole flushes */
+	if (host->out != NULL) {
+		(void)fflush(host->out);
+	}
+}
+
+static ssd1306_status_t ssd1306_host_tr_recover(void *ctx) {
+	ssd1306_host_t *host = (ssd1306_host_t *)ctx;
+
+	host->recoveries++;
+
+	return host->offline ? SSD1306_ERR : SSD1306_OK;
+}
+
+const ssd1306_transport_t ssd1306_transport_host = {
+	NULL,
+	ssd1306_host_tr_write,
+	ssd1306_host_tr_write_cmds,
+	NULL,
+	ssd1306_host_tr_flush_complete,
+	NULL,
+	NULL,
+	ssd1306_host_tr_recover,
+	&ssd1306_host,
+#ifdef SSD1306_USE_SPI
+	0U,	/* stats as on the modelled bus: CS/DC framing */
+#else
+	2U,	/* stats as on the modelled bus: address + control byte */
+#endif
+	NULL,
+#ifdef SSD1306_USE_SPI
+	2U	/* flush planning as on the modelled bus */
+#else
+	3U
+#endif
+};
+
+/* =======================================================================
+ * Timing and platform hooks
+ * ======================================================================= */
+
+void ssd1306_time_init(uint32_t hclk_hz) {
+	(void)hclk_hz;
+}
+
+void ssd1306_time_delay_ms(uint32_t ms) {
+	struct timespec ts;
+
+	ts.tv_sec = (time_t)(ms / 1000U);
+	ts.tv_nsec = (long)(ms % 1000U) * 1000000L;
+	while (nanosleep(&ts, &ts) != 0) {
+		;
+	}
+}
+
+uint32_t ssd1306_time_ticks_ms(void) {
+	struct timespec ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint32_t)((uint64_t)ts.tv_sec * 1000U + (uint64_t)ts.tv_nsec / 1000000U);
+}
+
+void ssd1306_port_watchdog_feed(void) {
+	;
+}
+
+#endif /* SSD1306_MCU_HOST */
@@ -15,48 +15,217 @@
  * -------------------------------------------------------------------------- */
 
 SSD1306_State_t ssd1306_state;
+SSD1306_Clip_t ssd1306_clip = { 0, 0, SSD1306_WIDTH - 1, SSD1306_HEIGHT - 1 };
 uint8_t ssd1306_buffer[SSD1306_BUFFER_SIZE];
 uint8_t ssd1306_dirty_flags[SSD1306_DIRTY_FLAGS_SIZE];
+uint8_t ssd1306_dirty_min[SSD1306_PAGES];
+uint8_t ssd1306_dirty_max[SSD1306_PAGES];
+
+#ifdef SSD1306_DOUBLE_BUFFER
+uint8_t ssd1306_front_buffer[SSD1306_BUFFER_SIZE];
+uint8_t ssd1306_front_dirty_flags[SSD1306_DIRTY_FLAGS_SIZE];
+uint8_t ssd1306_front_dirty_min[SSD1306_PAGES];
+uint8_t ssd1306_front_dirty_max[SSD1306_PAGES];
+#endif
+
+#ifdef SSD1306_STATS
+SSD1306_Stats_t ssd1306_stats;
+#endif
+
+#ifdef SSD1306_SHADOW_GRAM
+uint8_t ssd1306_gram_shadow[SSD1306_BUFFER_SIZE];
+#endif
+
+#ifdef SSD1306_SHADOW_HASH
+uint32_t ssd1306_page_hash[SSD1306_PAGES];
+uint8_t ssd1306_page_hash_valid[SSD1306_PAGES];
+#endif
 
 /* --------------------------------------------------------------------------
  * Low-level write helpers
  * -------------------------------------------------------------------------- */
 
+/* Active transport (ssd1306_init_ex) */
+const ssd1306_transport_t *ssd1306_transport = &SSD1306_TRANSPORT_DEFAULT;
+
+/* Inside ssd1306_bus_flush_begin/complete, and its first error */
+static uint8_t ssd1306_bus_in_flush;
+static ssd1306_status_t ssd1306_bus_status;
+
+/* Skip the rest of a flush once one of its transactions has failed */
+static uint8_t ssd1306_bus_failed(void) {
+	return (uint8_t)(ssd1306_bus_in_flush && ssd1306_bus_status != SSD1306_OK);
+}
+
+static void ssd1306_bus_result(ssd1306_status_t rc) {
+	if (rc != SSD1306_OK && ssd1306_bus_status == SSD1306_OK) {
+		ssd1306_bus_status = rc;
+	}
+}
+
+#ifdef SSD1306_STATS
+static void ssd1306_bus_count(uint32_t payload) {
+	ssd1306_stats.transactions++;
+	ssd1306_stats.bytes += ssd1306_transport->framing_bytes + payload;
+}
+#endif
+
+/* Every data transfer to the controller goes through here */
+static void ssd1306_bus_write(const ssd1306_iovec_t *iov, uint8_t count) {
+#ifdef SSD1306_STATS
+	uint32_t payload;
+	uint8_t i;
+#endif
+
+	if (ssd1306_bus_failed()) {
+		return;
+	}
+
+#ifdef SSD1306_STATS
+	payload = 0;
+	for (i = 0; i < count; i++) {
+		payload += iov[i].size;
+	}
+	ssd1306_bus_count(payload);
+#endif
+#ifdef SSD1306_DOUBLE_BUFFER
+	/* Data comes from the front frame, which ssd1306_swap_buffers()
+	 * changes only once the transport is idle: it can be sent in place */
+	if (ssd1306_transport->write_stable) {
+		ssd1306_bus_result(ssd1306_transport->write_stable(ssd1306_transport->ctx, iov, count));
+		return;
+	}
+#endif
+	ssd1306_bus_result(ssd1306_transport->write(ssd1306_transport->ctx, iov, count));
+}
+
 void ssd1306_write_command(uint8_t byte) {
-	uint8_t pkt[2];
+	ssd1306_write_commands(&byte, 1);
+}
+
+void ssd1306_write_commands(const uint8_t *cmds, uint16_t count) {
+	if (ssd1306_bus_failed()) {
+		return;
+	}
+#ifdef SSD1306_STATS
+	ssd1306_bus_count(count);
+#endif
+	ssd1306_bus_result(ssd1306_transport->write_cmds(ssd1306_transport->ctx, cmds, count));
+}
+
+void ssd1306_bus_flush_begin(void) {
+	ssd1306_bus_in_flush = 1;
+	ssd1306_bus_status = SSD1306_OK;
 
-	pkt[0] = 0x00;	/* control: Co=0, D/C#=0 */
-	pkt[1] = byte;
+	if (ssd1306_transport->flush_begin) {
+		ssd1306_transport->flush_begin(ssd1306_transport->ctx, SSD1306_FLUSH_TIMEOUT);
+	}
+}
+
+/* End of a flush: let the transport push out what it has */
+ssd1306_status_t ssd1306_bus_flush_complete(void) {
+	ssd1306_status_t rc = ssd1306_bus_status;
+
+	if (ssd1306_transport->flush_complete) {
+		ssd1306_transport->flush_complete(ssd1306_transport->ctx);
+	}
 
-	(void)ssd1306_port_i2c_write(pkt, 2);
+	ssd1306_bus_in_flush = 0;
+	ssd1306_bus_status = SSD1306_OK;
+
+	return rc;
 }
 
 void ssd1306_write_command_ex(uint8_t cmd, uint8_t param) {
-	ssd1306_write_command(cmd);
-	ssd1306_write_command(param);
+	uint8_t cmds[2];
+
+	cmds[0] = cmd;
+	cmds[1] = param;
+
+	ssd1306_write_commands(cmds, 2);
+
+	if (cmd == SSD1306_CMD_SET_MEMORY_MODE) {
+		ssd1306_state.addr_mode = (uint8_t)(param & 0x03u);
+	}
 }
 
-void ssd1306_write_data(uint8_t *buffer, uint16_t size) {
-	uint8_t	pkt[1 + SSD1306_WIDTH];
-	uint16_t i;
-	uint16_t n = size;
+/* Advance the tracked write pointer past 'n' data bytes */
+static void ssd1306_gram_advance(uint16_t n) {
+	uint16_t width;
+	uint16_t pages;
+	uint16_t total;
 
-	if (n > SSD1306_WIDTH) {
-		n = SSD1306_WIDTH;
+	if (!ssd1306_state.gram_valid) {
+		return;
 	}
 
-	pkt[0] = 0x40; /* control: Co=0, D/C#=1 */
-	for (i = 0; i < n; i++) {
-		pkt[1 + i] = buffer[i];
+	width = (uint16_t)(ssd1306_state.win_col_end - ssd1306_state.win_col_start + 1U);
+	pages = (uint16_t)(ssd1306_state.win_page_end - ssd1306_state.win_page_start + 1U);
+	total = (uint16_t)(ssd1306_state.gram_column - ssd1306_state.win_col_start + n);
+
+	switch (ssd1306_state.addr_mode) {
+	case SSD1306_ADDR_MODE_HORIZONTAL:
+		/* Column wraps to the window start and the page advances,
+		 * wrapping inside the page window
+		 */
+		ssd1306_state.gram_column = (uint8_t)(ssd1306_state.win_col_start + total % width);
+		ssd1306_state.gram_page = (uint8_t)(ssd1306_state.win_page_start +
+			(ssd1306_state.gram_page - ssd1306_state.win_page_start + total / width) % pages);
+		break;
+
+	case SSD1306_ADDR_MODE_PAGE:
+		/* Column wraps within the same page */
+		ssd1306_state.gram_column = (uint8_t)(ssd1306_state.win_col_start + total % width);
+		break;
+
+	default:
+		/* Vertical (or unknown) mode: not tracked */
+		ssd1306_state.gram_valid = 0;
+		break;
 	}
+}
+
+/* Append the 0x21/0x22 commands for a window (GRAM coordinates) to 'cmds'
+ * and track it; the controller moves the pointer to its start.
+ */
+static uint16_t ssd1306_window_cmds(uint8_t *cmds,
+                                    uint8_t page0,
+                                    uint8_t page1,
+                                    uint8_t col0,
+                                    uint8_t col1) {
+	cmds[0] = SSD1306_CMD_SET_COLUMN_ADDR;
+	cmds[1] = col0;
+	cmds[2] = col1;
+	cmds[3] = SSD1306_CMD_SET_PAGE_ADDR;
+	cmds[4] = page0;
+	cmds[5] = page1;
+
+	ssd1306_state.win_col_start = col0;
+	ssd1306_state.win_col_end = col1;
+	ssd1306_state.win_page_start = page0;
+	ssd1306_state.win_page_end = page1;
+	ssd1306_state.gram_column = col0;
+	ssd1306_state.gram_page = page0;
+	ssd1306_state.gram_valid = 1;
+
+	return 6;
+}
+
+void ssd1306_write_data(const uint8_t *buffer, uint16_t size) {
+	ssd1306_iovec_t iov;
 
-	(void)ssd1306_port_i2c_write(pkt, (uint16_t)(1 + n));
+	iov.data = buffer;
+	iov.size = size;
+
+	ssd1306_bus_write(&iov, 1);
+	ssd1306_gram_advance(size);
 }
 
 void ssd1306_set_page(uint8_t page) {
 	uint8_t offset_page = (uint8_t)(page + SSD1306_PAGE_OFFSET);
 
 	ssd1306_write_command((uint8_t)(SSD1306_CMD_SET_PAGE_START | (offset_page & 0x07)));
+	ssd1306_state.gram_page = (uint8_t)(offset_page & 0x07);
 }
 
 void ssd1306_set_column(uint8_t column) {
@@ -64,6 +233,95 @@ void ssd1306_set_column(uint8_t column) {
 
 	ssd1306_write_command((uint8_t)(SSD1306_CMD_SET_LOW_COLUMN  | (offset_column & 0x0F)));
 	ssd1306_write_command((uint8_t)(SSD1306_CMD_SET_HIGH_COLUMN | ((offset_column >> 4) & 0x0F)));
+	ssd1306_state.gram_column = (uint8_t)(offset_column & 0x7F);
+}
+
+void ssd1306_gram_seek(uint8_t page, uint8_t column) {
+	uint8_t offset_page = (uint8_t)((page + SSD1306_PAGE_OFFSET) & 0x07);
+	uint8_t offset_column = (uint8_t)((column + SSD1306_X_OFFSET) & 0x7F);
+	uint8_t cmds[9];
+	uint16_t n = 0;
+
+	/* Page/column commands are used with the whole-GRAM window only */
+	if (!ssd1306_state.gram_valid ||
+	    ssd1306_state.win_col_start != 0U ||
+	    ssd1306_state.win_col_end != SSD1306_GRAM_COLUMNS - 1U ||
+	    ssd1306_state.win_page_start != 0U ||
+	    ssd1306_state.win_page_end != SSD1306_GRAM_PAGES - 1U) {
+		n = ssd1306_window_cmds(cmds, 0, SSD1306_GRAM_PAGES - 1U, 0, SSD1306_GRAM_COLUMNS - 1U);
+	}
+
+	if (offset_page != ssd1306_state.gram_page) {
+		cmds[n++] = (uint8_t)(SSD1306_CMD_SET_PAGE_START | offset_page);
+		ssd1306_state.gram_page = offset_page;
+	}
+
+	if (offset_column != ssd1306_state.gram_column) {
+		cmds[n++] = (uint8_t)(SSD1306_CMD_SET_LOW_COLUMN  | (offset_column & 0x0F));
+		cmds[n++] = (uint8_t)(SSD1306_CMD_SET_HIGH_COLUMN | ((offset_column >> 4) & 0x0F));
+		ssd1306_state.gram_column = offset_column;
+	}
+
+	if (n > 0U) {
+		ssd1306_write_commands(cmds, n);
+	}
+}
+
+void ssd1306_send_window(uint8_t page0, uint8_t page1, uint8_t col0, uint8_t col1) {
+	ssd1306_iovec_t iov[SSD1306_PAGES];
+	uint8_t count;
+	uint8_t cmds[6];
+	uint8_t gram_page0 = (uint8_t)(page0 + SSD1306_PAGE_OFFSET);
+	uint8_t gram_page1 = (uint8_t)(page1 + SSD1306_PAGE_OFFSET);
+	uint8_t gram_col0 = (uint8_t)(col0 + SSD1306_X_OFFSET);
+	uint8_t gram_col1 = (uint8_t)(col1 + SSD1306_X_OFFSET);
+	uint16_t width;
+	uint8_t page;
+
+	/* Program the window unless it is already set with the pointer at
+	 * its start (e.g. the same rectangle flushed again)
+	 */
+	if (!ssd1306_state.gram_valid ||
+	    ssd1306_state.win_col_start != gram_col0 ||
+	    ssd1306_state.win_col_end != gram_col1 ||
+	    ssd1306_state.win_page_start != gram_page0 ||
+	    ssd1306_state.win_page_end != gram_page1 ||
+	    ssd1306_state.gram_column != gram_col0 ||
+	    ssd1306_state.gram_page != gram_page0) {
+		ssd1306_write_commands(cmds, ssd1306_window_cmds(cmds, gram_page0, gram_page1, gram_col0, gram_col1));
+	}
+
+	/* The rows go out back to back, read in place, as few transactions
+	 * as SSD1306_DATA_TX_MAX allows: the controller wraps at col1 to the
+	 * next page
+	 */
+	width = (uint16_t)(col1 - col0 + 1U);
+	count = 0;
+
+	for (page = page0; page <= page1; page++) {
+		if ((uint32_t)(count + 1U) * width > SSD1306_DATA_TX_MAX) {
+			ssd1306_bus_write(iov, count);
+			ssd1306_gram_advance((uint16_t)(width * count));
+			count = 0;
+		}
+		iov[count].data = &SSD1306_TX_BUFFER[(uint32_t)page * SSD1306_WIDTH + col0];
+		iov[count].size = width;
+		count++;
+	}
+
+	ssd1306_bus_write(iov, count);
+	ssd1306_gram_advance((uint16_t)(width * count));
+
+	for (page = page0; page <= page1; page++) {
+		ssd1306_dirty_clear_range(page, col0, col1);
+#ifdef SSD1306_SHADOW_GRAM
+		memcpy(&ssd1306_gram_shadow[(uint32_t)page * SSD1306_WIDTH + col0],
+		       &SSD1306_TX_BUFFER[(uint32_t)page * SSD1306_WIDTH + col0], width);
+#endif
+#ifdef SSD1306_SHADOW_HASH
+		ssd1306_page_hash_update(page);
+#endif
+	}
 }
 
 /* --------------------------------------------------------------------------
@@ -73,33 +331,426 @@ void ssd1306_set_column(uint8_t column) {
 void ssd1306_send_block(uint8_t x, uint8_t page, uint32_t n_bytes) {
 	uint32_t n_bytes_actual;
 	uint32_t page_index;
-	uint32_t dirty_index;
-	uint32_t i;
 
 	/* Clamp block size so we don't write past the right screen edge */
 	n_bytes_actual = SSD1306_MIN(n_bytes, (uint32_t)(SSD1306_WIDTH - x));
+	if (n_bytes_actual == 0U) {
+		return;
+	}
+
 	page_index = (uint32_t)page * (uint32_t)SSD1306_WIDTH;
-	dirty_index = (uint32_t)(x + page * SSD1306_WIDTH) / 8U;
 
-	ssd1306_write_data(&ssd1306_buffer[x + page_index], (uint16_t)n_bytes_actual);
+	ssd1306_write_data(&SSD1306_TX_BUFFER[x + page_index], (uint16_t)n_bytes_actual);
+	ssd1306_dirty_clear_range(page, x, (uint8_t)(x + n_bytes_actual - 1U));
+#ifdef SSD1306_SHADOW_GRAM
+	memcpy(&ssd1306_gram_shadow[x + page_index], &SSD1306_TX_BUFFER[x + page_index], n_bytes_actual);
+#endif
+}
+
+/* Set (value = 0xFF) or clear (value = 0x00) bits x0..x1 of one page in 'flags' */
+static void ssd1306_dirty_write_range(uint8_t *flags, uint8_t page, uint8_t x0, uint8_t x1, uint8_t value) {
+	uint32_t first;
+	uint32_t last;
+	uint32_t first_byte;
+	uint32_t last_byte;
+	uint8_t first_mask;
+	uint8_t last_mask;
+
+	first = (uint32_t)page * SSD1306_WIDTH + x0;
+	last = (uint32_t)page * SSD1306_WIDTH + x1;
+	first_byte = first / 8U;
+	last_byte = last / 8U;
+	first_mask = (uint8_t)(0xFFu << (first % 8U));
+	last_mask = (uint8_t)(0xFFu >> (7U - (last % 8U)));
+
+	if (first_byte == last_byte) {
+		first_mask &= last_mask;
+		flags[first_byte] =
+			(uint8_t)((flags[first_byte] & (uint8_t)~first_mask) | (value & first_mask));
+		return;
+	}
+
+	flags[first_byte] =
+		(uint8_t)((flags[first_byte] & (uint8_t)~first_mask) | (value & first_mask));
+	if (last_byte > first_byte + 1U) {
+		memset(&flags[first_byte + 1U], value, last_byte - first_byte - 1U);
+	}
+	flags[last_byte] =
+		(uint8_t)((flags[last_byte] & (uint8_t)~last_mask) | (value & last_mask));
+}
+
+void ssd1306_dirty_mark_range(uint8_t page, uint8_t x0, uint8_t x1) {
+	ssd1306_dirty_write_range(ssd1306_dirty_flags, page, x0, x1, 0xFFu);
+
+	if (x0 < ssd1306_dirty_min[page]) {
+		ssd1306_dirty_min[page] = x0;
+	}
+	if (x1 > ssd1306_dirty_max[page]) {
+		ssd1306_dirty_max[page] = x1;
+	}
+}
+
+void ssd1306_dirty_clear_range(uint8_t page, uint8_t x0, uint8_t x1) {
+	ssd1306_dirty_write_range(SSD1306_TX_DIRTY_FLAGS, page, x0, x1, 0x00u);
+
+	if (SSD1306_TX_DIRTY_MIN[page] > SSD1306_TX_DIRTY_MAX[page]) {
+		return;
+	}
+
+	/* Shrink the extent only when the cleared range covers one of its
+	 * ends; a hole in the middle keeps the (conservative) extent.
+	 */
+	if (x0 <= SSD1306_TX_DIRTY_MIN[page] && x1 >= SSD1306_TX_DIRTY_MAX[page]) {
+		SSD1306_TX_DIRTY_MIN[page] = 0xFFu;
+		SSD1306_TX_DIRTY_MAX[page] = 0x00u;
+	} else if (x0 <= SSD1306_TX_DIRTY_MIN[page] && x1 >= SSD1306_TX_DIRTY_MIN[page]) {
+		SSD1306_TX_DIRTY_MIN[page] = (uint8_t)(x1 + 1U);
+	} else if (x0 <= SSD1306_TX_DIRTY_MAX[page] && x1 >= SSD1306_TX_DIRTY_MAX[page]) {
+		SSD1306_TX_DIRTY_MAX[page] = (uint8_t)(x0 - 1U);
+	}
+}
+
+void ssd1306_dirty_mark_all(void) {
+	memset(ssd1306_dirty_flags, 0xFF, sizeof(ssd1306_dirty_flags));
+	memset(ssd1306_dirty_min, 0x00, sizeof(ssd1306_dirty_min));
+	memset(ssd1306_dirty_max, SSD1306_WIDTH - 1, sizeof(ssd1306_dirty_max));
+}
+
+void ssd1306_dirty_sync_extents(void) {
+	const uint8_t *flags;
+	uint8_t page;
+	uint8_t i;
+	uint8_t bit;
+	uint8_t byte;
+
+	for (page = 0; page < SSD1306_PAGES; page++) {
+		flags = &ssd1306_dirty_flags[(uint32_t)page * SSD1306_WIDTH_BYTES];
+		ssd1306_dirty_min[page] = 0xFFu;
+		ssd1306_dirty_max[page] = 0x00u;
+
+		for (i = 0; i < SSD1306_WIDTH_BYTES; i++) {
+			byte = flags[i];
+			if (byte == 0u) {
+				continue;
+			}
+			if (ssd1306_dirty_min[page] == 0xFFu) {
+				for (bit = 0; ((byte >> bit) & 0x01u) == 0u; bit++) {
+				}
+				ssd1306_dirty_min[page] = (uint8_t)(i * 8U + bit);
+			}
+			for (bit = 7; ((byte >> bit) & 0x01u) == 0u; bit--) {
+			}
+			ssd1306_dirty_max[page] = (uint8_t)(i * 8U + bit);
+		}
+	}
+}
+
+#ifdef SSD1306_SHADOW_GRAM
+void ssd1306_dirty_refine(uint8_t trusted) {
+	const uint8_t *src;
+	const uint8_t *shadow;
+	uint8_t *flags;
+	uint8_t page;
+	uint16_t x;
+	uint16_t x_last;
+	int16_t first, last;
+
+	if (!trusted) {
+		return;
+	}
+
+	for (page = 0; page < SSD1306_PAGES; page++) {
+		if (SSD1306_TX_DIRTY_MIN[page] > SSD1306_TX_DIRTY_MAX[page]) {
+			continue;
+		}
+
+		src = &SSD1306_TX_BUFFER[(uint32_t)page * SSD1306_WIDTH];
+		shadow = &ssd1306_gram_shadow[(uint32_t)page * SSD1306_WIDTH];
+		flags = &SSD1306_TX_DIRTY_FLAGS[(uint32_t)page * SSD1306_WIDTH_BYTES];
+		x_last = SSD1306_TX_DIRTY_MAX[page];
+		first = -1;
+		last = -1;
+
+		for (x = SSD1306_TX_DIRTY_MIN[page]; x <= x_last; x++) {
+			if (((flags[x / 8u] >> (x % 8u)) & 0x01u) == 0u) {
+				continue;
+			}
+			if (src[x] == shadow[x]) {
+				/* Panel already shows this byte */
+				flags[x / 8u] &= (uint8_t)~(1u << (x % 8u));
+				continue;
+			}
+			if (first < 0) {
+				first = (int16_t)x;
+			}
+			last = (int16_t)x;
+		}
+
+		if (first < 0) {
+			SSD1306_TX_DIRTY_MIN[page] = 0xFFu;
+			SSD1306_TX_DIRTY_MAX[page] = 0x00u;
+		} else {
+			SSD1306_TX_DIRTY_MIN[page] = (uint8_t)first;
+			SSD1306_TX_DIRTY_MAX[page] = (uint8_t)last;
+		}
+	}
+}
+#endif
+
+#ifdef SSD1306_SHADOW_HASH
+/* FNV-1a over one page of SSD1306_TX_BUFFER */
+static uint32_t ssd1306_page_hash_of(uint8_t page) {
+	const uint8_t *src = &SSD1306_TX_BUFFER[(uint32_t)page * SSD1306_WIDTH];
+	uint32_t hash = 2166136261UL;
+	uint16_t x;
 
-	/* Clear dirty flags in the left partial byte of the range */
-	if ((x % 8U) != 0U) {
-		ssd1306_dirty_flags[dirty_index] &= (uint8_t)(0xFFu << (x % 8U));
+	for (x = 0; x < SSD1306_WIDTH; x++) {
+		hash = (hash ^ src[x]) * 16777619UL;
 	}
 
-	/* Clear dirty flags in fully covered bytes of the range */
-	for (i = 0; i < (n_bytes_actual / 8U); i++) {
-		ssd1306_dirty_flags[dirty_index + i] = 0x00;
+	return hash;
+}
+
+void ssd1306_dirty_refine(uint8_t trusted) {
+	uint8_t page;
+
+	if (!trusted) {
+		return;
 	}
 
-	/* Clear dirty flags in the right partial byte of the range */
-	if (((x + n_bytes_actual) % 8U) != 0U) {
-		ssd1306_dirty_flags[dirty_index + (n_bytes_actual / 8U)] &=
-			(uint8_t)(0xFFu << ((x + n_bytes_actual) % 8U));
+	for (page = 0; page < SSD1306_PAGES; page++) {
+		if (SSD1306_TX_DIRTY_MIN[page] > SSD1306_TX_DIRTY_MAX[page] ||
+		    !ssd1306_page_hash_valid[page]) {
+			continue;
+		}
+
+		if (ssd1306_page_hash_of(page) == ssd1306_page_hash[page]) {
+			/* Same content as the panel shows: nothing to do on this page */
+			ssd1306_dirty_clear_range(page, 0, SSD1306_WIDTH - 1U);
+		}
 	}
+}
 
-	ssd1306_state.cursor_x = (uint16_t)(x + n_bytes_actual);
+void ssd1306_page_hash_update(uint8_t page) {
+	/* Only a page with nothing left to send is known to match the panel */
+	if (SSD1306_TX_DIRTY_MIN[page] > SSD1306_TX_DIRTY_MAX[page]) {
+		ssd1306_page_hash[page] = ssd1306_page_hash_of(page);
+		ssd1306_page_hash_valid[page] = 1;
+	} else {
+		ssd1306_page_hash_valid[page] = 0;
+	}
+}
+#endif
+
+/* ssd1306_buffer_write_span() on one framebuffer page */
+static void ssd1306_buffer_write_span_fb(uint8_t page,
+                                         uint8_t x0,
+                                         uint8_t x1,
+                                         uint8_t mask,
+                                         SSD1306_COLOR_t color) {
+	uint8_t *ptr;
+	uint8_t old_value;
+	uint8_t new_value;
+	uint8_t set_bits;
+	uint8_t keep_bits;
+	uint16_t x;
+	int16_t changed_first = -1;
+	int16_t changed_last = -1;
+
+	/* White: OR the mask in; Black: AND it out */
+	set_bits = (color == White) ? mask : 0x00u;
+	keep_bits = (uint8_t)~mask;
+	ptr = &ssd1306_buffer[(uint32_t)page * SSD1306_WIDTH + x0];
+
+	for (x = x0; x <= x1; x++, ptr++) {
+		old_value = *ptr;
+		new_value = (uint8_t)((old_value & keep_bits) | set_bits);
+
+		if (new_value != old_value) {
+			*ptr = new_value;
+			if (changed_first < 0) {
+				changed_first = (int16_t)x;
+			}
+			changed_last = (int16_t)x;
+		}
+	}
+
+	if (changed_first >= 0) {
+		ssd1306_dirty_mark_range(page, (uint8_t)changed_first, (uint8_t)changed_last);
+	}
+}
+
+void ssd1306_buffer_write_span(uint8_t page,
+                               uint8_t x0,
+                               uint8_t x1,
+                               uint8_t mask,
+                               SSD1306_COLOR_t color) {
+	uint8_t shift = (uint8_t)(ssd1306_state.start_line % 8u);
+	uint8_t fb_page = (uint8_t)((page + ssd1306_state.start_line / 8u) % SSD1306_PAGES);
+
+	if ((uint8_t)(mask << shift) != 0u) {
+		ssd1306_buffer_write_span_fb(fb_page, x0, x1, (uint8_t)(mask << shift), color);
+	}
+	if (shift != 0u && (uint8_t)(mask >> (8u - shift)) != 0u) {
+		ssd1306_buffer_write_span_fb((uint8_t)((fb_page + 1u) % SSD1306_PAGES), x0, x1,
+		                             (uint8_t)(mask >> (8u - shift)), color);
+	}
+}
+
+/*
+ * Every raster op is applied as  dst = (dst & A) ^ X,  where A and X are
+ * selected per bit by the source bit s:
+ *   A = s ? and_set : and_clear,   X = s ? xor_set : 0
+ * so one branch-free expression covers all ops at byte granularity.
+ * Indexed by SSD1306_ROP_t; TRANSPARENT is resolved to OR / AND_NOT first.
+ */
+typedef struct {
+	uint8_t and_set;
+	uint8_t and_clear;
+	uint8_t xor_set;
+} ssd1306_rop_terms_t;
+
+static const ssd1306_rop_terms_t ssd1306_rop_terms[] = {
+	{ 0x00u, 0x00u, 0xFFu },	/* COPY:    dst = s        */
+	{ 0x00u, 0xFFu, 0xFFu },	/* (TRANSPARENT, resolved) */
+	{ 0x00u, 0xFFu, 0xFFu },	/* OR:      dst = dst | s  */
+	{ 0xFFu, 0x00u, 0x00u },	/* AND:     dst = dst & s  */
+	{ 0xFFu, 0xFFu, 0xFFu },	/* XOR:     dst = dst ^ s  */
+	{ 0x00u, 0xFFu, 0x00u },	/* AND_NOT: dst = dst & ~s */
+};
+
+void ssd1306_buffer_blit_pages(int16_t x,
+                               int16_t y,
+                               const uint8_t *src,
+                               uint8_t width,
+                               uint8_t height,
+                               SSD1306_COLOR_t color,
+                               SSD1306_ROP_t rop) {
+	int16_t x_first, x_last;
+	int16_t y_first, y_last;
+	int16_t src_row;
+	int16_t src_page;
+	uint8_t src_pages;
+	uint8_t offset;
+	uint8_t page, page_first, page_last;
+	uint8_t row_first, row_last;
+	uint8_t mask;
+	uint8_t invert;
+	uint8_t col, col_first, col_last;
+	uint8_t lo, hi;
+	uint8_t bits;
+	uint8_t and_bits, xor_bits;
+	uint8_t old_value, new_value;
+	uint8_t *dst;
+	const uint8_t *line_lo;
+	const uint8_t *line_hi;
+	const ssd1306_rop_terms_t *terms;
+	int16_t changed_first, changed_last;
+
+	if (!src || width == 0u || height == 0u || (uint8_t)rop > SSD1306_ROP_AND_NOT) {
+		return;
+	}
+
+	/* Clip against the current clip rectangle */
+	x_first = SSD1306_MAX(x, ssd1306_clip.x0);
+	y_first = SSD1306_MAX(y, ssd1306_clip.y0);
+	x_last = SSD1306_MIN((int16_t)(x + width - 1), ssd1306_clip.x1);
+	y_last = SSD1306_MIN((int16_t)(y + height - 1), ssd1306_clip.y1);
+
+	if (x_first > x_last || y_first > y_last) {
+		return;
+	}
+
+	/* Work in framebuffer rows, past the last one where the start line
+	 * wraps the display: page numbers are taken modulo SSD1306_PAGES */
+	y = (int16_t)(y + ssd1306_state.start_line);
+	y_first = (int16_t)(y_first + ssd1306_state.start_line);
+	y_last = (int16_t)(y_last + ssd1306_state.start_line);
+
+	/* Transparent drawing sets (White) or clears (Black) the image bits
+	 * only; all other ops take 'color' as the source polarity.
+	 */
+	if (rop == SSD1306_ROP_TRANSPARENT) {
+		rop = (color == White) ? SSD1306_ROP_OR : SSD1306_ROP_AND_NOT;
+		invert = 0x00u;
+	} else {
+		invert = (color == White) ? 0x00u : 0xFFu;
+	}
+	terms = &ssd1306_rop_terms[rop];
+
+	col_first = (uint8_t)(x_first - x);
+	col_last = (uint8_t)(x_last - x);
+	src_pages = (uint8_t)((height + 7u) / 8u);
+	page_first = (uint8_t)(y_first / 8);
+	page_last = (uint8_t)(y_last / 8);
+
+	for (page = page_first; page <= page_last; page++) {
+		/* Visible rows of the image inside this destination page */
+		row_first = (page == page_first) ? (uint8_t)(y_first % 8) : 0u;
+		row_last = (page == page_last) ? (uint8_t)(y_last % 8) : 7u;
+		mask = (uint8_t)((0xFFu << row_first) & (0xFFu >> (7u - row_last)));
+
+		/* Top row of this page in image coordinates: the destination byte
+		 * is source page 'src_page' shifted up by 'offset', merged with the
+		 * next source page shifted down.
+		 */
+		src_row = (int16_t)(page * 8 - y);
+		src_page = (int16_t)((src_row >= 0) ? (src_row / 8) : ((src_row - 7) / 8));
+		offset = (uint8_t)(src_row - src_page * 8);
+
+		line_lo = (src_page >= 0 && src_page < (int16_t)src_pages) ?
+			&src[(uint16_t)src_page * width] : (const uint8_t *)0;
+		line_hi = (offset != 0u && src_page + 1 >= 0 && src_page + 1 < (int16_t)src_pages) ?
+			&src[(uint16_t)(src_page + 1) * width] : (const uint8_t *)0;
+
+		dst = &ssd1306_buffer[(uint32_t)(page % SSD1306_PAGES) * SSD1306_WIDTH + (uint32_t)x_first];
+		changed_first = -1;
+		changed_last = -1;
+
+		if (rop == SSD1306_ROP_COPY && offset == 0u && mask == 0xFFu) {
+			/* Opaque, page-aligned full page: straight byte copy */
+			for (col = col_first; col <= col_last; col++, dst++) {
+				bits = (uint8_t)(line_lo[col] ^ invert);
+				if (*dst != bits) {
+					*dst = bits;
+					if (changed_first < 0) {
+						changed_first = (int16_t)col;
+					}
+					changed_last = (int16_t)col;
+				}
+			}
+		} else {
+			/* Generic path: shift-merge two source pages, then apply
+			 * the raster op to the rows selected by 'mask'.
+			 */
+			for (col = col_first; col <= col_last; col++, dst++) {
+				lo = line_lo ? line_lo[col] : 0x00u;
+				hi = line_hi ? line_hi[col] : 0x00u;
+				bits = (uint8_t)((uint8_t)(lo >> offset) | (uint8_t)(hi << (8u - offset)));
+				bits ^= invert;
+
+				and_bits = (uint8_t)((bits & terms->and_set) | ((uint8_t)~bits & terms->and_clear));
+				xor_bits = (uint8_t)(bits & terms->xor_set);
+
+				old_value = *dst;
+				new_value = (uint8_t)((old_value & (and_bits | (uint8_t)~mask)) ^ (xor_bits & mask));
+
+				if (new_value != old_value) {
+					*dst = new_value;
+					if (changed_first < 0) {
+						changed_first = (int16_t)col;
+					}
+					changed_last = (int16_t)col;
+				}
+			}
+		}
+
+		if (changed_first >= 0) {
+			ssd1306_dirty_mark_range((uint8_t)(page % SSD1306_PAGES),
+			                         (uint8_t)(x + changed_first),
+			                         (uint8_t)(x + changed_last));
+		}
+	}
 }
 
 /* --------------------------------------------------------------------------
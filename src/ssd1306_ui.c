@@ -16,6 +16,16 @@ static void ssd1306_ui_buffer_draw_menu_item(const SSD1306_Menu_t *menu, const c
 				       uint8_t y, uint8_t selected,
 				       uint8_t left_margin, uint8_t right_margin);
 static void percent_to_str(uint8_t v, char out[6]);
+static void ssd1306_ui_buffer_fill_arrow(uint8_t tip_x, uint8_t tip_y,
+					 int8_t dx, int8_t dy, SSD1306_COLOR_t color);
+#ifdef SSD1306_UI_MENU_START_LINE
+static uint8_t ssd1306_ui_menu_pages(int16_t y, int16_t h, uint8_t line);
+static uint16_t ssd1306_ui_menu_label_width(const SSD1306_Menu_t *menu, int16_t index);
+static uint8_t ssd1306_ui_menu_shift(SSD1306_Menu_t *menu, const SSD1306_MenuLayout *layout);
+
+/* SSD1306_Menu_t.drawn_offset of a menu not on screen */
+#define SSD1306_UI_MENU_NOT_DRAWN 0xFFu
+#endif
 
 /* Set runtime auto-flush behavior for ssd1306_ui_draw_* functions.
  * This overrides SSD1306_UI_AUTO_FLUSH_DEFAULT from ssd1306_conf.h.
@@ -111,6 +121,29 @@ void ssd1306_ui_draw_header(const SSD1306_Header_t *header) {
 /* =======================================================================
  * Scrollbar
  * ======================================================================= */
+
+/*
+ * Scrollbar arrow head: 5 spans from the tip back along (dx, dy), widening
+ * by one pixel on each side every second span (1, 1, 3, 3, 5). Drawn as
+ * lines rather than with ssd1306_buffer_fill_triangle(), whose top-left rule
+ * drops the bottom/right edge and cannot centre a 1-pixel tip.
+ */
+static void ssd1306_ui_buffer_fill_arrow(uint8_t tip_x, uint8_t tip_y,
+					 int8_t dx, int8_t dy, SSD1306_COLOR_t color) {
+	int16_t i, half, x, y;
+
+	for (i = 0; i < 5; i++) {
+		half = (int16_t)(i / 2);
+		x = (int16_t)(tip_x + dx * i);
+		y = (int16_t)(tip_y + dy * i);
+		if (dx == 0) {
+			ssd1306_buffer_draw_line(x - half, y, x + half, y, color);
+		} else {
+			ssd1306_buffer_draw_line(x, y - half, x, y + half, color);
+		}
+	}
+}
+
 SSD1306_Scrollbar_t ssd1306_ui_scrollbar_init(uint8_t x, uint8_t y,
 					      uint8_t width, uint8_t height,
 					      uint8_t total_items,
@@ -165,24 +198,10 @@ void ssd1306_ui_draw_scrollbar(const SSD1306_Scrollbar_t *bar) {
 					 White);
 
 		/* Up arrow */
-		ssd1306_buffer_fill_triangle(
-			(uint8_t)(center_x - 3u),
-			(uint8_t)(inner_y + 5u),
-			(uint8_t)(center_x + 3u),
-			(uint8_t)(inner_y + 5u),
-			center_x,
-			inner_y,
-			White);
+		ssd1306_ui_buffer_fill_arrow(center_x, inner_y, 0, 1, White);
 
 		/* Down arrow */
-		ssd1306_buffer_fill_triangle(
-			(uint8_t)(center_x - 2u),
-			(uint8_t)(inner_y + inner_height - 5u),
-			(uint8_t)(center_x + 2u),
-			(uint8_t)(inner_y + inner_height - 5u),
-			center_x,
-			(uint8_t)(inner_y + inner_height - 1u),
-			White);
+		ssd1306_ui_buffer_fill_arrow(center_x, (uint8_t)(inner_y + inner_height - 1u), 0, -1, White);
 
 		/* Slider, 3 pixels wide */
 		usable_top = (uint8_t)(inner_y + 7u);
@@ -216,24 +235,10 @@ void ssd1306_ui_draw_scrollbar(const SSD1306_Scrollbar_t *bar) {
 			White);
 
 		/* Left arrow */
-		ssd1306_buffer_fill_triangle(
-			(uint8_t)(inner_x - 1u + 4u),
-			(uint8_t)(center_y - 2u),
-			(uint8_t)(inner_x - 1u + 4u),
-			(uint8_t)(center_y + 2u),
-			(uint8_t)(inner_x - 1u),
-			center_y,
-			White);
+		ssd1306_ui_buffer_fill_arrow((uint8_t)(inner_x - 1u), center_y, 1, 0, White);
 
 		/* Right arrow */
-		ssd1306_buffer_fill_triangle(
-			(uint8_t)(inner_x + 1u + inner_width - 6u),
-			(uint8_t)(center_y - 2u),
-			(uint8_t)(inner_x + 1u + inner_width - 6u),
-			(uint8_t)(center_y + 2u),
-			(uint8_t)(inner_x + 1u + inner_width - 1u),
-			center_y,
-			White);
+		ssd1306_ui_buffer_fill_arrow((uint8_t)(inner_x + inner_width), center_y, -1, 0, White);
 
 		/* Slider, 3 pixels high */
 		usable_left = (uint8_t)(inner_x + 7u);
@@ -284,14 +289,18 @@ static void ssd1306_ui_buffer_draw_menu_item(const SSD1306_Menu_t *menu,
 	int16_t x;
 	uint16_t text_width;
 
-	if (!text || !text[0]) {
-		return;
-	}
-
 	line_height = (uint8_t)(menu->font->height + menu->line_spacing);
 	fg = selected ? Black : White;
 	bg = selected ? White : Black;
 
+	/* Keep the item, including text longer than the row, inside its row */
+	(void)ssd1306_clip_push(
+		left_margin,
+		y,
+		(uint8_t)(right_margin - left_margin),
+		line_height
+	);
+
 	ssd1306_buffer_fill_rect(
 		left_margin,
 		y,
@@ -300,6 +309,11 @@ static void ssd1306_ui_buffer_draw_menu_item(const SSD1306_Menu_t *menu,
 		bg
 	);
 
+	if (!text || !text[0]) {
+		ssd1306_clip_pop();
+		return;
+	}
+
 	text_width = ssd1306_calc_text_width(text, menu->font->width);
 
 	if (menu->alignment == SSD1306_TEXT_ALIGN_CENTER) {
@@ -310,15 +324,17 @@ static void ssd1306_ui_buffer_draw_menu_item(const SSD1306_Menu_t *menu,
 		x = (int16_t)left_margin;
 	}
 
-	ssd1306_buffer_draw_string_font(
+	/* Background is already filled: draw only the glyph pixels */
+	ssd1306_buffer_draw_string_font_ex(
 		text,
 		(uint8_t)x,
 		y,
 		menu->font,
-		fg
+		fg,
+		SSD1306_ROP_TRANSPARENT
 	);
 
-
+	ssd1306_clip_pop();
 }
 
 SSD1306_Menu_t ssd1306_ui_menu_init(const char *const *items,
@@ -340,6 +356,11 @@ SSD1306_Menu_t ssd1306_ui_menu_init(const char *const *items,
 	menu.total_count    = count;
 	menu.selected_index = 0;
 	menu.visible_offset = 0;
+#ifdef SSD1306_UI_MENU_START_LINE
+	menu.drawn_offset   = SSD1306_UI_MENU_NOT_DRAWN;
+	menu.drawn_selected = 0;
+	menu.drawn_fill     = 0;
+#endif
 	menu.font           = font;
 	menu.header         = header;
 	menu.line_spacing   = line_spacing;
@@ -394,31 +415,153 @@ SSD1306_Menu_t ssd1306_ui_menu_init(const char *const *items,
 	return menu;
 }
 
+#ifdef SSD1306_UI_MENU_START_LINE
+/* Framebuffer pages holding display rows y .. y + h - 1 when display
+ * row 0 is framebuffer row 'line' */
+static uint8_t ssd1306_ui_menu_pages(int16_t y, int16_t h, uint8_t line) {
+	int16_t row;
+	int16_t end;
+
+	if (h <= 0) {
+		return 0;
+	}
+
+	row = (int16_t)((y + line) % SSD1306_HEIGHT);
+	end = (int16_t)(row + h - 1);
+	if (end < SSD1306_HEIGHT) {
+		return (uint8_t)(end / 8 - row / 8 + 1);
+	}
+
+	/* Wraps from the last page to the first */
+	return (uint8_t)SSD1306_MIN(SSD1306_PAGES - row / 8 + (end - SSD1306_HEIGHT) / 8 + 1, SSD1306_PAGES);
+}
+
+/* Label width of item 'index', 0 past the last item */
+static uint16_t ssd1306_ui_menu_label_width(const SSD1306_Menu_t *menu, int16_t index) {
+	if (index < 0 || index >= (int16_t)menu->total_count || !menu->items[index]) {
+		return 0;
+	}
+
+	return ssd1306_calc_text_width(menu->items[index], menu->font->width);
+}
+
+/*
+ * When visible_offset has moved by less than a screenful since the last
+ * draw, move the picture along with the items and return 1: the items
+ * still in view then land on their new rows and need no repaint. Rows
+ * brought in from the opposite edge hold stale content; the parts the
+ * menu does not paint over (header area, padding) are cleared here.
+ *
+ * Moving by a multiple of the line height re-aligns the header and the
+ * highlight bar against the pages, so the shift is only taken when it
+ * changes fewer bytes (pages times columns) than repainting in place:
+ * there, a row changes across its whole width only where the highlight
+ * comes or goes, and under the wider of its two labels otherwise.
+ */
+static uint8_t ssd1306_ui_menu_shift(SSD1306_Menu_t *menu, const SSD1306_MenuLayout *layout) {
+	int16_t items;
+	int16_t rows;
+	int16_t bottom;
+	int16_t in_y;
+	int16_t y;
+	int16_t old_index;
+	int16_t new_index;
+	uint16_t row_width;
+	uint16_t width;
+	uint32_t shift_cost;
+	uint32_t repaint_cost;
+	uint8_t line;
+	uint8_t i;
+
+	/* Wiped by a buffer fill since */
+	if (menu->drawn_fill != ssd1306_state.fill_count) {
+		menu->drawn_offset = SSD1306_UI_MENU_NOT_DRAWN;
+	}
+
+	items = (int16_t)menu->visible_offset - (int16_t)menu->drawn_offset;
+	if (menu->drawn_offset == SSD1306_UI_MENU_NOT_DRAWN || items == 0 ||
+	    items >= (int16_t)menu->max_visible || items <= -(int16_t)menu->max_visible) {
+		return 0;
+	}
+
+	rows = (int16_t)(items * layout->line_height);
+	line = (uint8_t)(((int16_t)ssd1306_state.start_line + rows % SSD1306_HEIGHT + SSD1306_HEIGHT) %
+	                 SSD1306_HEIGHT);
+	bottom = (int16_t)(layout->y_offset + layout->menu_height);
+	in_y = (items > 0) ? (int16_t)(bottom - rows) : (int16_t)layout->y_offset;
+	rows = (int16_t)((rows < 0) ? -rows : rows);
+
+	row_width = (uint16_t)(SSD1306_WIDTH - menu->padding.left - menu->padding.right -
+	                       (menu->scrollbar.enabled ? (int16_t)menu->scrollbar.width : 0));
+
+	/* Shifted: header and the bands around the menu are redrawn on new
+	 * rows, rows brought in and kept rows whose highlight changes are
+	 * repainted */
+	shift_cost = (uint32_t)SSD1306_WIDTH *
+	             (ssd1306_ui_menu_pages(0, layout->y_offset, line) +
+	              ssd1306_ui_menu_pages(bottom, (int16_t)(SSD1306_HEIGHT - bottom), line)) +
+	             (uint32_t)row_width * ssd1306_ui_menu_pages(in_y, rows, line);
+
+	repaint_cost = 0;
+	for (i = 0; i < menu->max_visible; i++) {
+		y = (int16_t)(layout->y_offset + i * layout->line_height);
+		new_index = (int16_t)(menu->visible_offset + i);
+		old_index = (int16_t)(menu->drawn_offset + i);
+
+		/* Kept item: repainted when shifted only if its highlight changes */
+		if (menu->selected_index != menu->drawn_selected && (y < in_y || y >= in_y + rows) &&
+		    (new_index == menu->selected_index || new_index == menu->drawn_selected)) {
+			shift_cost += (uint32_t)row_width * ssd1306_ui_menu_pages(y, layout->line_height, line);
+		}
+
+		/* In place: old item 'old_index' gives way to 'new_index' */
+		if ((old_index == menu->drawn_selected) != (new_index == menu->selected_index)) {
+			width = row_width;
+		} else {
+			width = SSD1306_MAX(ssd1306_ui_menu_label_width(menu, old_index),
+			                    ssd1306_ui_menu_label_width(menu, new_index));
+			width = SSD1306_MIN(width, row_width);
+		}
+		repaint_cost += (uint32_t)width *
+		                ssd1306_ui_menu_pages(y, layout->line_height, ssd1306_state.start_line);
+	}
+
+	if (shift_cost >= repaint_cost) {
+		return 0;
+	}
+
+	if (ssd1306_buffer_scroll_rows((int8_t)(items * layout->line_height)) != SSD1306_OK) {
+		return 0;
+	}
+
+	ssd1306_buffer_fill_rect(0, 0, SSD1306_WIDTH, layout->y_offset, Black);
+	ssd1306_buffer_fill_rect(0, bottom, SSD1306_WIDTH, (int16_t)(SSD1306_HEIGHT - bottom), Black);
+	ssd1306_buffer_fill_rect(0, in_y, menu->padding.left, rows, Black);
+	ssd1306_buffer_fill_rect((int16_t)(SSD1306_WIDTH - menu->padding.right), in_y,
+	                         menu->padding.right, rows, Black);
+
+	return 1;
+}
+#endif
+
 void ssd1306_ui_draw_menu(SSD1306_Menu_t *menu) {
 	SSD1306_MenuLayout layout;
-	uint8_t menu_x;
-	uint8_t menu_width;
 	uint8_t left_margin;
 	uint8_t right_margin;
 	uint8_t i;
+#ifdef SSD1306_UI_MENU_START_LINE
+	uint8_t shifted;
+#endif
 
 	if (!menu) {
 		return;
 	}
 
 	layout    = _ssd1306_ui_calc_layout(menu);
-	menu_x    = menu->padding.left;
-	menu_width = (uint8_t)(SSD1306_WIDTH
-			       - menu->padding.left
-			       - menu->padding.right);
 
-	ssd1306_buffer_fill_rect(
-		menu_x,
-		layout.y_offset,
-		menu_width,
-		layout.menu_height,
-		Black
-	);
+#ifdef SSD1306_UI_MENU_START_LINE
+	shifted = ssd1306_ui_menu_shift(menu, &layout);
+#endif
 
 	left_margin  = menu->padding.left;
 	right_margin = (uint8_t)(SSD1306_WIDTH - menu->padding.right);
@@ -437,14 +580,30 @@ void ssd1306_ui_draw_menu(SSD1306_Menu_t *menu) {
 		uint8_t y;
 		const char *text;
 
+		/* Every row repaints its own background (rows past the last
+		 * item as empty items), and the scrollbar clears its area, so
+		 * the menu is drawn without clearing it first.
+		 */
 		item_index = (uint8_t)(menu->visible_offset + i);
-		if (item_index >= menu->total_count) {
-			break;
+		y = (uint8_t)(layout.y_offset + (uint8_t)(i * layout.line_height));
+
+		if (item_index < menu->total_count) {
+			selected = (item_index == menu->selected_index) ? 1u : 0u;
+			text = menu->items[item_index];
+		} else {
+			selected = 0u;
+			text = (const char *)0;
 		}
 
-		selected = (item_index == menu->selected_index) ? 1u : 0u;
-		y = (uint8_t)(layout.y_offset + (uint8_t)(i * layout.line_height));
-		text = menu->items[item_index];
+#ifdef SSD1306_UI_MENU_START_LINE
+		/* Already moved into place, highlight unchanged */
+		if (shifted && text &&
+		    item_index >= menu->drawn_offset &&
+		    item_index < (uint8_t)(menu->drawn_offset + menu->max_visible) &&
+		    selected == ((item_index == menu->drawn_selected) ? 1u : 0u)) {
+			continue;
+		}
+#endif
 
 		ssd1306_ui_buffer_draw_menu_item(
 			menu,
@@ -456,6 +615,12 @@ void ssd1306_ui_draw_menu(SSD1306_Menu_t *menu) {
 		);
 	}
 
+#ifdef SSD1306_UI_MENU_START_LINE
+	menu->drawn_offset = menu->visible_offset;
+	menu->drawn_selected = menu->selected_index;
+	menu->drawn_fill = ssd1306_state.fill_count;
+#endif
+
 	if (menu->scrollbar.enabled) {
 		menu->scrollbar.offset = menu->visible_offset;
 		ssd1306_ui_draw_scrollbar(&menu->scrollbar);
@@ -528,6 +693,16 @@ void ssd1306_ui_menu_scroll_down(SSD1306_Menu_t *menu) {
 
 }
 
+void ssd1306_ui_menu_invalidate(SSD1306_Menu_t *menu) {
+	if (!menu) {
+		return;
+	}
+
+#ifdef SSD1306_UI_MENU_START_LINE
+	menu->drawn_offset = SSD1306_UI_MENU_NOT_DRAWN;
+#endif
+}
+
 /* =======================================================================
  * Progress bar
  * ======================================================================= */
@@ -620,12 +795,13 @@ void ssd1306_ui_draw_progressbar(const SSD1306_ProgressBar_t *bar) {
 			Black
 		);
 
-		ssd1306_buffer_draw_string_font(
+		ssd1306_buffer_draw_string_font_ex(
 			percent_str,
 			(uint8_t)px,
 			(uint8_t)py,
 			SSD1306_FONT_DEFAULT,
-			White
+			White,
+			SSD1306_ROP_TRANSPARENT
 		);
 	}
 
@@ -11,8 +11,10 @@
 
 #include <stdint.h>
 #include "ssd1306_utils.h"
-#include "ssd1306_port.h"
 #include "ssd1306_priv.h"
+#ifndef SSD1306_MCU_HOST
+#include "ssd1306_port_stm32.h"
+#endif
 
 /* =======================================================================
  * Geometry / clipping helpers
@@ -23,15 +25,15 @@ uint8_t ssd1306_geom_compute_out_code(int16_t x, int16_t y) {
 
 	code = SSD1306_CS_INSIDE;
 
-	if (x < 0) {
+	if (x < ssd1306_clip.x0) {
 		code |= SSD1306_CS_LEFT;
-	} else if (x >= SSD1306_WIDTH) {
+	} else if (x > ssd1306_clip.x1) {
 		code |= SSD1306_CS_RIGHT;
 	}
 
-	if (y < 0) {
+	if (y < ssd1306_clip.y0) {
 		code |= SSD1306_CS_TOP;
-	} else if (y >= SSD1306_HEIGHT) {
+	} else if (y > ssd1306_clip.y1) {
 		code |= SSD1306_CS_BOTTOM;
 	}
 
@@ -46,10 +48,45 @@ void ssd1306_util_swap_int(int *a, int *b) {
 	*b = t;
 }
 
+void ssd1306_util_transpose8(const uint8_t *rows, uint16_t stride, uint8_t cols[8]) {
+	uint32_t x;
+	uint32_t y;
+	uint32_t t;
+
+	/* Rows are loaded bottom-up so that the result has the top scanline
+	 * in bit 0 (Hacker's Delight transpose8, 32-bit variant).
+	 */
+	x = ((uint32_t)rows[7u * stride] << 24) | ((uint32_t)rows[6u * stride] << 16) |
+	    ((uint32_t)rows[5u * stride] << 8)  |  (uint32_t)rows[4u * stride];
+	y = ((uint32_t)rows[3u * stride] << 24) | ((uint32_t)rows[2u * stride] << 16) |
+	    ((uint32_t)rows[1u * stride] << 8)  |  (uint32_t)rows[0];
+
+	t = (x ^ (x >> 7)) & 0x00AA00AAu;  x = x ^ t ^ (t << 7);
+	t = (y ^ (y >> 7)) & 0x00AA00AAu;  y = y ^ t ^ (t << 7);
+	t = (x ^ (x >> 14)) & 0x0000CCCCu; x = x ^ t ^ (t << 14);
+	t = (y ^ (y >> 14)) & 0x0000CCCCu; y = y ^ t ^ (t << 14);
+
+	t = (x & 0xF0F0F0F0u) | ((y >> 4) & 0x0F0F0F0Fu);
+	y = ((x << 4) & 0xF0F0F0F0u) | (y & 0x0F0F0F0Fu);
+	x = t;
+
+	cols[0] = (uint8_t)(x >> 24);
+	cols[1] = (uint8_t)(x >> 16);
+	cols[2] = (uint8_t)(x >> 8);
+	cols[3] = (uint8_t)x;
+	cols[4] = (uint8_t)(y >> 24);
+	cols[5] = (uint8_t)(y >> 16);
+	cols[6] = (uint8_t)(y >> 8);
+	cols[7] = (uint8_t)y;
+}
+
 /* =======================================================================
  * Timing helpers (DWT / SysTick)
  * ======================================================================= */
 
+/* The host backend (ssd1306_port_host.c) provides its own */
+#ifndef SSD1306_MCU_HOST
+
 /* Internal timing state */
 static uint8_t  s_use_dwt = 0;
 static uint32_t s_core_hz = 0;
@@ -137,3 +174,5 @@ uint32_t ssd1306_time_ticks_ms(void) {
 		return ms;
 	}
 }
+
+#endif /* SSD1306_MCU_HOST */
@@ -0,0 +1,114 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Даниил Еремеев
+ * See LICENSE file for details.
+ */
+
+/*
+ * stm32f1xx.h (simulator)
+ * The subset of the CMSIS device header that the I2C transports (with
+ * the DMA channel) and the timing helpers use, backed by the register
+ * model of tools/ssd1306_i2csim.c. Only for host builds of that tool.
+ */
+
+#ifndef SSD1306_I2CSIM_STM32F1XX_H
+#define SSD1306_I2CSIM_STM32F1XX_H
+
+#include <stdint.h>
+
+#define __IO volatile
+
+typedef struct {
+	__IO uint32_t CR1, CR2, OAR1, OAR2, DR, SR1, SR2, CCR, TRISE;
+} I2C_TypeDef;
+
+typedef struct {
+	__IO uint32_t ISR, IFCR;
+} DMA_TypeDef;
+
+/* The address registers are as wide as a host pointer, so the channel
+ * reads from exactly where the port pointed it (uint32_t on the MCU) */
+typedef struct {
+	__IO uint32_t CCR, CNDTR;
+	__IO uintptr_t CPAR, CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct {
+	__IO uint32_t CTRL, CYCCNT;
+} DWT_Type;
+
+typedef struct {
+	__IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+	__IO uint32_t CTRL, LOAD, VAL, CALIB;
+} SysTick_Type;
+
+extern I2C_TypeDef sim_i2c1, sim_i2c2;
+extern DMA_TypeDef sim_dma1;
+extern DMA_Channel_TypeDef sim_dma1_channel[7];
+extern DWT_Type sim_dwt;
+extern CoreDebug_Type sim_core_debug;
+extern SysTick_Type sim_systick;
+
+#define I2C1       (&sim_i2c1)
+#define I2C2       (&sim_i2c2)
+#define DMA1           (&sim_dma1)
+#define DMA1_Channel1  (&sim_dma1_channel[0])
+#define DMA1_Channel2  (&sim_dma1_channel[1])
+#define DMA1_Channel3  (&sim_dma1_channel[2])
+#define DMA1_Channel4  (&sim_dma1_channel[3])
+#define DMA1_Channel5  (&sim_dma1_channel[4])
+#define DMA1_Channel6  (&sim_dma1_channel[5])
+#define DMA1_Channel7  (&sim_dma1_channel[6])
+#define DWT        (&sim_dwt)
+#define CoreDebug  (&sim_core_debug)
+#define SysTick    (&sim_systick)
+
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0)
+#define SysTick_CTRL_COUNTFLAG_Msk  (1UL << 16)
+
+#define I2C_CR1_PE       0x0001U
+#define I2C_CR1_START    0x0100U
+#define I2C_CR1_STOP     0x0200U
+#define I2C_CR1_ACK      0x0400U
+#define I2C_CR1_SWRST    0x8000U
+
+#define I2C_CR2_ITERREN  0x0100U
+#define I2C_CR2_ITEVTEN  0x0200U
+#define I2C_CR2_ITBUFEN  0x0400U
+#define I2C_CR2_DMAEN    0x0800U
+
+#define I2C_SR1_SB       0x0001U
+#define I2C_SR1_ADDR     0x0002U
+#define I2C_SR1_BTF      0x0004U
+#define I2C_SR1_TXE      0x0080U
+#define I2C_SR1_BERR     0x0100U
+#define I2C_SR1_ARLO     0x0200U
+#define I2C_SR1_AF       0x0400U
+#define I2C_SR1_OVR      0x0800U
+#define I2C_SR1_TIMEOUT  0x4000U
+
+#define I2C_SR2_MSL      0x0001U
+#define I2C_SR2_BUSY     0x0002U
+
+#define DMA_CCR_EN       0x0001U
+#define DMA_CCR_TCIE     0x0002U
+#define DMA_CCR_HTIE     0x0004U
+#define DMA_CCR_TEIE     0x0008U
+#define DMA_CCR_DIR      0x0010U
+#define DMA_CCR_CIRC     0x0020U
+#define DMA_CCR_PINC     0x0040U
+#define DMA_CCR_MINC     0x0080U
+
+extern uint32_t SystemCoreClock;
+void SystemCoreClockUpdate(void);
+
+/* Every idle cycle of the driver advances the simulated bus (and DMA
+ * channel) by one core clock and may raise their interrupts */
+void sim_cycle(void);
+#define __NOP()  sim_cycle()
+
+#endif /* SSD1306_I2CSIM_STM32F1XX_H */
@@ -0,0 +1,120 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Даниил Еремеев
+ * See LICENSE file for details.
+ */
+
+/*
+ * stm32f1xx.h (simulator)
+ * The subset of the CMSIS device header that the SPI transports (polled
+ * or with the DMA channel) and the timing helpers use, backed by the
+ * register model of tools/ssd1306_spisim.c. Only for host builds of that
+ * tool.
+ */
+
+#ifndef SSD1306_SPISIM_STM32F1XX_H
+#define SSD1306_SPISIM_STM32F1XX_H
+
+#include <stdint.h>
+
+#define __IO volatile
+
+/*
+ * SR is a function the model answers, read as SPIx->SR (see the SR macro
+ * below): a status read straight after a DR write has to see that write,
+ * and a plain register would only catch up on the next core cycle.
+ */
+typedef struct {
+	__IO uint32_t CR1, CR2;
+	uint32_t (*SR)(void);
+	__IO uint32_t DR, CRCPR, RXCRCR, TXCRCR;
+} SPI_TypeDef;
+
+typedef struct {
+	__IO uint32_t CRL, CRH, IDR, ODR, BSRR, BRR, LCKR;
+} GPIO_TypeDef;
+
+typedef struct {
+	__IO uint32_t ISR, IFCR;
+} DMA_TypeDef;
+
+/* The address registers are as wide as a host pointer, so the channel
+ * reads from exactly where the port pointed it (uint32_t on the MCU) */
+typedef struct {
+	__IO uint32_t CCR, CNDTR;
+	__IO uintptr_t CPAR, CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct {
+	__IO uint32_t CTRL, CYCCNT;
+} DWT_Type;
+
+typedef struct {
+	__IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+	__IO uint32_t CTRL, LOAD, VAL, CALIB;
+} SysTick_Type;
+
+#define SR  SR()
+
+extern SPI_TypeDef sim_spi1, sim_spi2;
+extern GPIO_TypeDef sim_gpioa, sim_gpiob, sim_gpioc;
+extern DMA_TypeDef sim_dma1;
+extern DMA_Channel_TypeDef sim_dma1_channel[7];
+extern DWT_Type sim_dwt;
+extern CoreDebug_Type sim_core_debug;
+extern SysTick_Type sim_systick;
+
+/* Pin writes of one statement reach the model before the next one picks
+ * a port, so CS and DC edges are seen in program order */
+GPIO_TypeDef *sim_gpio(GPIO_TypeDef *gpio);
+
+#define SPI1           (&sim_spi1)
+#define SPI2           (&sim_spi2)
+#define GPIOA          (sim_gpio(&sim_gpioa))
+#define GPIOB          (sim_gpio(&sim_gpiob))
+#define GPIOC          (sim_gpio(&sim_gpioc))
+#define DMA1           (&sim_dma1)
+#define DMA1_Channel1  (&sim_dma1_channel[0])
+#define DMA1_Channel2  (&sim_dma1_channel[1])
+#define DMA1_Channel3  (&sim_dma1_channel[2])
+#define DMA1_Channel4  (&sim_dma1_channel[3])
+#define DMA1_Channel5  (&sim_dma1_channel[4])
+#define DMA1_Channel6  (&sim_dma1_channel[5])
+#define DMA1_Channel7  (&sim_dma1_channel[6])
+#define DWT            (&sim_dwt)
+#define CoreDebug      (&sim_core_debug)
+#define SysTick        (&sim_systick)
+
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0)
+#define SysTick_CTRL_COUNTFLAG_Msk  (1UL << 16)
+
+#define SPI_CR1_MSTR     0x0004U
+#define SPI_CR1_SPE      0x0040U
+
+#define SPI_CR2_TXDMAEN  0x0002U
+
+#define SPI_SR_TXE       0x0002U
+#define SPI_SR_BSY       0x0080U
+
+#define DMA_CCR_EN       0x0001U
+#define DMA_CCR_TCIE     0x0002U
+#define DMA_CCR_HTIE     0x0004U
+#define DMA_CCR_TEIE     0x0008U
+#define DMA_CCR_DIR      0x0010U
+#define DMA_CCR_CIRC     0x0020U
+#define DMA_CCR_PINC     0x0040U
+#define DMA_CCR_MINC     0x0080U
+
+extern uint32_t SystemCoreClock;
+void SystemCoreClockUpdate(void);
+
+/* Every idle cycle of the driver advances the simulated bus (and DMA
+ * channel) by one core clock and may raise the DMA interrupt */
+void sim_cycle(void);
+#define __NOP()  sim_cycle()
+
+#endif /* SSD1306_SPISIM_STM32F1XX_H */
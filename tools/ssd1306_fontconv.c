@@ -0,0 +1,124 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Даниил Еремеев
+ * See LICENSE file for details.
+ */
+
+/*
+ * ssd1306_fontconv.c
+ * Host-side converter: regenerates the built-in row-major font arrays of
+ * src/ssd1306_fonts.c in the SSD1306 page-major (GRAM) layout.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -std=c99 -Iinclude -Isrc -Isrc/inc tools/ssd1306_fontconv.c -o fontconv
+ *   ./fontconv > src/ssd1306_fonts_pages.c
+ *
+ * Page-major glyph layout (SSD1306_FONT_LAYOUT_PAGE_MAJOR):
+ *   glyph[page * width + column], bit 0 = top row of the page,
+ *   width * ceil(height / 8) bytes per glyph, glyphs stored from 0x20.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "ssd1306_conf.h"
+
+/* Convert every font regardless of the project configuration */
+#undef SSD1306_FONT_USE_PAGE_MAJOR
+#define SSD1306_INCLUDE_FONT_8x8
+#define SSD1306_INCLUDE_FONT_7x11
+#define SSD1306_INCLUDE_FONT_7x14
+#define SSD1306_INCLUDE_FONT_11x21
+#define SSD1306_INCLUDE_FONT_16x30
+
+#include "ssd1306_fonts.c"
+
+typedef struct {
+	const char		*name;
+	const uint8_t	*data;
+	uint32_t		size;
+	uint8_t			width;
+	uint8_t			height;
+} fontconv_src_t;
+
+/* Pixel (x, y) of glyph 'g' in row-major MSB-first layout */
+static int fontconv_pixel(const fontconv_src_t *f, uint32_t g, uint8_t x, uint8_t y) {
+	uint32_t bytes_per_row;
+	uint32_t offset;
+
+	if (y >= f->height) {
+		return 0;
+	}
+
+	bytes_per_row = (uint32_t)(f->width + 7u) / 8u;
+	offset = g * f->height * bytes_per_row + (uint32_t)y * bytes_per_row + x / 8u;
+
+	return (f->data[offset] >> (7u - (x % 8u))) & 0x01u;
+}
+
+static void fontconv_emit(const fontconv_src_t *f) {
+	uint32_t bytes_per_row;
+	uint32_t glyphs;
+	uint32_t g;
+	uint8_t pages;
+	uint8_t page, col, bit;
+	uint8_t value;
+
+	bytes_per_row = (uint32_t)(f->width + 7u) / 8u;
+	glyphs = f->size / (f->height * bytes_per_row);
+	pages = (uint8_t)((f->height + 7u) / 8u);
+
+	printf("#if defined(SSD1306_FONT_USE_PAGE_MAJOR) && defined(SSD1306_INCLUDE_FONT_%s)\n", f->name);
+	printf("const uint8_t FONT_%s_PAGES_ARRAY[] = {\n", f->name);
+
+	for (g = 0; g < glyphs; g++) {
+		for (page = 0; page < pages; page++) {
+			printf("\t");
+			for (col = 0; col < f->width; col++) {
+				value = 0;
+				for (bit = 0; bit < 8u; bit++) {
+					if (fontconv_pixel(f, g, col, (uint8_t)(page * 8u + bit))) {
+						value |= (uint8_t)(1u << bit);
+					}
+				}
+				printf("0x%02X,%s", value, (col + 1u < f->width) ? " " : "");
+			}
+			if (page == 0u) {
+				printf(" /* 0x%02X */", (unsigned)(0x20u + g));
+			}
+			printf("\n");
+		}
+	}
+
+	printf("};\n#endif\n\n");
+}
+
+int main(void) {
+	static const fontconv_src_t fonts[] = {
+		{ "8x8",   FONT_8x8_ARRAY,   sizeof(FONT_8x8_ARRAY),   8,  8  },
+		{ "7x11",  FONT_7x11_ARRAY,  sizeof(FONT_7x11_ARRAY),  7,  11 },
+		{ "7x14",  FONT_7x14_ARRAY,  sizeof(FONT_7x14_ARRAY),  7,  14 },
+		{ "11x21", FONT_11x21_ARRAY, sizeof(FONT_11x21_ARRAY), 11, 21 },
+		{ "16x30", FONT_16x30_ARRAY, sizeof(FONT_16x30_ARRAY), 16, 30 },
+	};
+	uint32_t i;
+
+	printf("/*\n");
+	printf(" * MIT License\n");
+	printf(" * Copyright (c) 2025 Даниил Еремеев\n");
+	printf(" * See LICENSE file for details.\n");
+	printf(" */\n\n");
+	printf("/*\n");
+	printf(" * Built-in fonts in SSD1306 page-major (GRAM) layout.\n");
+	printf(" * Generated by tools/ssd1306_fontconv.c from src/ssd1306_fonts.c - do not edit.\n");
+	printf(" */\n\n");
+	printf("#include <stdint.h>\n");
+	printf("#include \"ssd1306_fonts.h\"\n\n");
+
+	for (i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+		fontconv_emit(&fonts[i]);
+	}
+
+	return 0;
+}
@@ -0,0 +1,632 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Даниил Еремеев
+ * See LICENSE file for details.
+ */
+
+/*
+ * ssd1306_i2csim.c
+ * Host-side simulator for the queued I2C transports: interrupt-driven
+ * (SSD1306_I2C_USE_IT) or DMA (SSD1306_I2C_USE_DMA). The real driver and
+ * port (src/) run against a register model of an I2C v1 peripheral that
+ * clocks bytes onto a simulated bus and raises the event/error interrupts
+ * (SB, ADDR, TXE, BTF, AF) the IT transport is built around; in the DMA
+ * build a model of the DMA1 channel feeds DR on TXE and raises the
+ * transfer-complete / transfer-error interrupt. A random drawing workload
+ * is flushed through it, and every
+ * transaction seen on the bus is written to stdout in the host
+ * transport's recording format (ssd1306_port_host.h), ready for
+ * tools/ssd1306_replay.c.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -std=c99 -DSSD1306_I2C_USE_IT -Itools/i2csim -Iinclude -Isrc/inc \
+ *      -Iassets src/ssd1306*.c assets/ssd1306*.c tools/ssd1306_i2csim.c -o i2csim
+ *   ./i2csim -o fb.pbm | ./replay -q -o gram.pbm && cmp fb.pbm gram.pbm
+ *
+ * The DMA build is the same with -DSSD1306_I2C_USE_DMA instead of
+ * -DSSD1306_I2C_USE_IT.
+ *
+ * Options: -f frames, -s seed, -w core cycles of application work per
+ * frame, -n N to NACK the address of every Nth transaction, -t N (DMA
+ * build) to fail every Nth DMA transfer halfway with a transfer error,
+ * -o to write the final framebuffer as PBM. After NACKs or transfer
+ * errors the driver resends the whole frame; the run ends once the
+ * display has caught up. Bus protocol violations are reported on stderr
+ * and make the exit status non-zero.
+ *
+ * Register accesses are not trapped: the model reacts to them on the next
+ * core cycle, and clears ADDR when the event handler returns, or in the
+ * DMA build once DMAEN is set (it cannot see the SR1/SR2 read sequence
+ * that does it on silicon; the port reads them right after). That is
+ * enough for interrupt handlers and the DMA path, which touch DR once
+ * per event, but not for the polled transport.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ssd1306.h"
+#include "ssd1306_priv.h"
+#include "ssd1306_port_stm32.h"
+
+#if defined(SSD1306_USE_SPI) || !defined(SSD1306_PORT_USE_QUEUE)
+#error "Build the I2C simulator with SSD1306_I2C_USE_IT or SSD1306_I2C_USE_DMA (and without SPI)"
+#endif
+
+/* Register model
+ * ------------------------------------------------------------------------ */
+
+I2C_TypeDef sim_i2c1, sim_i2c2;
+DMA_TypeDef sim_dma1;
+DMA_Channel_TypeDef sim_dma1_channel[7];
+DWT_Type sim_dwt;
+CoreDebug_Type sim_core_debug;
+SysTick_Type sim_systick;
+uint32_t SystemCoreClock = 8000000UL;
+
+void SystemCoreClockUpdate(void) {
+	;
+}
+
+#define SIM_I2C          (SSD1306_I2C_PORT)
+#define SIM_DR_EMPTY     0xFFFFFFFFUL	/* DR not written since last taken */
+#define SIM_BYTE_CYCLES  180U			/* 9 bit times at 400 kHz, 8 MHz core */
+#define SIM_EDGE_CYCLES  20U			/* START / STOP condition */
+#define SIM_IRQ_STUCK    1000U
+#define SIM_SETTLE_CYCLES 24000000UL	/* 3 s: past a link retry */
+
+#define SIM_ERRORS  (I2C_SR1_AF | I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_OVR | I2C_SR1_TIMEOUT)
+
+#ifdef SSD1306_PORT_USE_DMA
+#define SIM_DMA          (SSD1306_PORT_DMA)
+#define SIM_DMA_CH       (SSD1306_PORT_DMA_CHANNEL)
+#define SIM_DMA_SHIFT    (4U * (SSD1306_PORT_DMA_CHANNEL_NUM - 1U))
+#define SIM_DMA_GIF      (0x1UL << SIM_DMA_SHIFT)
+#define SIM_DMA_TCIF     (0x2UL << SIM_DMA_SHIFT)
+#define SIM_DMA_TEIF     (0x8UL << SIM_DMA_SHIFT)
+#endif
+
+typedef enum {
+	SIM_IDLE = 0,
+	SIM_START,		/* START condition on the wire */
+	SIM_SB,			/* waiting for the address in DR */
+	SIM_ADDRESS,	/* address on the wire */
+	SIM_ADDR,		/* address acknowledged, waiting for EV6 */
+	SIM_DATA,		/* data phase */
+	SIM_NACKED,		/* address not acknowledged, waiting for STOP */
+	SIM_STOP		/* STOP condition on the wire */
+} sim_phase_t;
+
+static struct {
+	sim_phase_t phase;
+	uint32_t wait;			/* cycles until the bus action in progress ends */
+	uint8_t  shifting;		/* a data byte is in the shift register */
+	uint8_t  shift;
+	uint8_t  tx[2 + SSD1306_BUFFER_SIZE + 64];
+	uint32_t tx_len;		/* bytes of this transaction, address first */
+	uint8_t  in_irq;
+	uint32_t nack_every;
+	uint32_t started;		/* transactions addressed */
+	uint32_t sent;			/* transactions completed */
+	uint32_t bytes;
+	uint32_t nacks;
+	uint32_t aborted;
+	uint32_t ev_irqs;
+	uint32_t er_irqs;
+#ifdef SSD1306_PORT_USE_DMA
+	uint8_t  dma_on;		/* transfer in progress */
+	uint8_t  dma_cut;		/* this transfer ended in a transfer error */
+	uint32_t dma_size;		/* CNDTR when the channel was enabled */
+	uint32_t dma_fail_at;	/* CNDTR at which to raise TE, 0: none */
+	uint32_t te_every;
+	uint32_t dma_transfers;
+	uint32_t dma_irqs;
+	uint32_t dma_errors;
+#endif
+	uint32_t stuck;
+	uint32_t errors;		/* protocol violations */
+	uint64_t cycles;
+} sim;
+
+static void sim_violation(const char *what) {
+	sim.errors++;
+	if (sim.errors <= 10U) {
+		fprintf(stderr, "i2csim: %s (cycle %lu)\n", what, (unsigned long)sim.cycles);
+	}
+}
+
+/* Record one transaction (address, control byte, payload) to stdout */
+static void sim_emit(void) {
+	uint8_t header[3];
+	uint32_t size;
+
+	if (sim.tx_len < 2U) {
+		sim_violation("STOP before the control byte");
+		return;
+	}
+	if (sim.tx[1] != 0x00u && sim.tx[1] != 0x40u) {
+		sim_violation("unexpected control byte");
+	}
+
+	size = sim.tx_len - 2U;
+	header[0] = sim.tx[1];
+	header[1] = (uint8_t)size;
+	header[2] = (uint8_t)(size >> 8);
+	fwrite(header, 1, sizeof(header), stdout);
+	fwrite(&sim.tx[2], 1, size, stdout);
+
+	sim.sent++;
+	sim.bytes += sim.tx_len;
+}
+
+static void sim_stop(I2C_TypeDef *i2c) {
+	i2c->CR1 &= ~I2C_CR1_STOP;
+	i2c->SR1 &= ~(I2C_SR1_SB | I2C_SR1_ADDR | I2C_SR1_TXE | I2C_SR1_BTF);
+	sim.phase = SIM_STOP;
+	sim.wait = SIM_EDGE_CYCLES;
+}
+
+/* Advance the bus by one core cycle */
+static void sim_bus(void) {
+	I2C_TypeDef *i2c = SIM_I2C;
+
+	if (sim.wait != 0U && --sim.wait != 0U) {
+		return;
+	}
+
+	switch (sim.phase) {
+	case SIM_IDLE:
+		if ((i2c->CR1 & I2C_CR1_START) != 0U) {
+			if ((i2c->CR1 & I2C_CR1_PE) == 0U) {
+				sim_violation("START with the peripheral disabled");
+			}
+			i2c->CR1 &= ~I2C_CR1_START;
+			i2c->SR2 |= I2C_SR2_BUSY | I2C_SR2_MSL;
+			sim.phase = SIM_START;
+			sim.wait = SIM_EDGE_CYCLES;
+		} else if (i2c->DR != SIM_DR_EMPTY) {
+			sim_violation("DR written on an idle bus");
+			i2c->DR = SIM_DR_EMPTY;
+		}
+		i2c->CR1 &= ~I2C_CR1_STOP;
+		break;
+
+	case SIM_START:
+		i2c->SR1 |= I2C_SR1_SB;
+		sim.phase = SIM_SB;
+		break;
+
+	case SIM_SB:
+		if ((i2c->CR1 & I2C_CR1_STOP) != 0U) {
+			sim.aborted++;
+			sim_stop(i2c);
+		} else if (i2c->DR != SIM_DR_EMPTY) {
+			sim.tx[0] = (uint8_t)i2c->DR;
+			sim.tx_len = 1;
+			i2c->DR = SIM_DR_EMPTY;
+			i2c->SR1 &= ~I2C_SR1_SB;
+			sim.started++;
+			sim.phase = SIM_ADDRESS;
+			sim.wait = SIM_BYTE_CYCLES;
+		}
+		break;
+
+	case SIM_ADDRESS:
+		if (sim.tx[0] != (uint8_t)SSD1306_I2C_ADDR) {
+			sim_violation("wrong slave address");
+		}
+		if (sim.nack_every != 0U && sim.started % sim.nack_every == 0U) {
+			sim.nacks++;
+			i2c->SR1 |= I2C_SR1_AF;
+			sim.phase = SIM_NACKED;
+		} else {
+			/* EV6, followed by EV8_1 (TXE) */
+			i2c->SR1 |= I2C_SR1_ADDR | I2C_SR1_TXE;
+			sim.phase = SIM_ADDR;
+		}
+		break;
+
+	case SIM_ADDR:
+		if ((i2c->CR1 & I2C_CR1_STOP) != 0U) {
+			sim.aborted++;
+			sim_stop(i2c);
+#ifdef SSD1306_PORT_USE_DMA
+		} else if ((i2c->CR2 & I2C_CR2_DMAEN) != 0U) {
+			/* The port reads SR1/SR2 right after setting DMAEN */
+			i2c->SR1 &= ~I2C_SR1_ADDR;
+			sim.phase = SIM_DATA;
+#endif
+		} else if (i2c->DR != SIM_DR_EMPTY) {
+			sim_violation("DR written before ADDR was handled");
+			i2c->DR = SIM_DR_EMPTY;
+		}
+		break;
+
+	case SIM_DATA:
+		if (sim.shifting) {
+			sim.shifting = 0;
+			if (sim.tx_len < sizeof(sim.tx)) {
+				sim.tx[sim.tx_len++] = sim.shift;
+			} else {
+				sim_violation("transaction too long");
+			}
+		}
+		if (i2c->DR != SIM_DR_EMPTY) {
+			sim.shift = (uint8_t)i2c->DR;
+			sim.shifting = 1;
+			sim.wait = SIM_BYTE_CYCLES;
+			i2c->DR = SIM_DR_EMPTY;
+			i2c->SR1 = (i2c->SR1 & ~I2C_SR1_BTF) | I2C_SR1_TXE;
+#ifdef SSD1306_PORT_USE_DMA
+		} else if ((i2c->CR1 & I2C_CR1_STOP) != 0U && sim.dma_cut) {
+			/* Cut short by a transfer error: not recorded, the driver
+			 * resends the frame */
+			sim.aborted++;
+			sim_stop(i2c);
+#endif
+		} else if ((i2c->CR1 & I2C_CR1_STOP) != 0U) {
+			sim_emit();
+			sim_stop(i2c);
+		} else {
+			i2c->SR1 |= I2C_SR1_TXE;
+			if (sim.tx_len > 1U) {
+				i2c->SR1 |= I2C_SR1_BTF;
+			}
+		}
+		break;
+
+	case SIM_NACKED:
+		if ((i2c->CR1 & I2C_CR1_STOP) != 0U) {
+			sim.aborted++;
+			sim_stop(i2c);
+		} else if (i2c->DR != SIM_DR_EMPTY) {
+			sim_violation("DR written after a NACK");
+			i2c->DR = SIM_DR_EMPTY;
+		}
+		break;
+
+	case SIM_STOP:
+		i2c->SR2 &= ~(I2C_SR2_BUSY | I2C_SR2_MSL);
+		sim.phase = SIM_IDLE;
+		break;
+	}
+}
+
+#ifdef SSD1306_PORT_USE_DMA
+
+/* Flags cleared by an IFCR write: CGIFx clears every flag of channel x */
+static uint32_t sim_dma_cleared(uint32_t ifcr) {
+	uint32_t clear = ifcr;
+	unsigned n;
+
+	for (n = 0; n < 7U; n++) {
+		if ((ifcr & (0x1UL << (4U * n))) != 0U) {
+			clear |= 0xFUL << (4U * n);
+		}
+	}
+
+	return clear;
+}
+
+/* Advance the DMA channel by one core cycle: one byte into DR per TXE
+ * request while I2C DMAEN is set */
+static void sim_dma(void) {
+	I2C_TypeDef *i2c = SIM_I2C;
+	DMA_Channel_TypeDef *ch = SIM_DMA_CH;
+	const uint8_t *mem;
+
+	/* IFCR: write 1 to clear */
+	SIM_DMA->ISR &= ~sim_dma_cleared(SIM_DMA->IFCR);
+	SIM_DMA->IFCR = 0;
+
+	if ((ch->CCR & DMA_CCR_EN) == 0U) {
+		sim.dma_on = 0;
+		return;
+	}
+	if (!sim.dma_on) {
+		if (ch->CNDTR == 0U) {
+			/* Finished, not disabled yet */
+			return;
+		}
+		/* Channel (re)armed: it may be disabled, set up and enabled
+		 * again between two cycles */
+		sim.dma_on = 1;
+		sim.dma_size = ch->CNDTR;
+		sim.dma_transfers++;
+		sim.dma_fail_at = 0;
+		sim.dma_cut = 0;
+		if (sim.te_every != 0U && sim.dma_transfers % sim.te_every == 0U) {
+			sim.dma_fail_at = ch->CNDTR / 2U + 1U;
+		}
+		if ((ch->CCR & (DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_PINC | DMA_CCR_CIRC)) !=
+		    (DMA_CCR_DIR | DMA_CCR_MINC)) {
+			sim_violation("DMA channel not set up memory to peripheral");
+		}
+		if (ch->CPAR != (uintptr_t)&i2c->DR) {
+			sim_violation("DMA channel not pointed at I2C DR");
+		}
+	}
+
+	if (ch->CNDTR == 0U || (i2c->CR2 & I2C_CR2_DMAEN) == 0U ||
+	    sim.phase != SIM_DATA || (i2c->SR1 & I2C_SR1_TXE) == 0U ||
+	    i2c->DR != SIM_DR_EMPTY) {
+		return;
+	}
+
+	if (ch->CNDTR == sim.dma_fail_at) {
+		/* Transfer error: the channel disables itself */
+		sim.dma_errors++;
+		sim.dma_cut = 1;
+		sim.dma_on = 0;
+		ch->CCR &= ~DMA_CCR_EN;
+		SIM_DMA->ISR |= SIM_DMA_GIF | SIM_DMA_TEIF;
+		return;
+	}
+
+	mem = (const uint8_t *)(uintptr_t)ch->CMAR;
+	i2c->DR = mem[sim.dma_size - ch->CNDTR];
+	ch->CNDTR--;
+	if (ch->CNDTR == 0U) {
+		sim.dma_on = 0;
+		SIM_DMA->ISR |= SIM_DMA_GIF | SIM_DMA_TCIF;
+	}
+}
+
+/* Raise the channel interrupt when enabled and pending */
+static void sim_irq(void) {
+	uint32_t ccr = SIM_DMA_CH->CCR;
+	uint32_t isr = SIM_DMA->ISR & (SIM_DMA_TCIF | SIM_DMA_TEIF);
+
+	if (sim.in_irq) {
+		return;
+	}
+	if (((isr & SIM_DMA_TCIF) == 0U || (ccr & DMA_CCR_TCIE) == 0U) &&
+	    ((isr & SIM_DMA_TEIF) == 0U || (ccr & DMA_CCR_TEIE) == 0U)) {
+		return;
+	}
+
+	sim.in_irq = 1;
+	sim.dma_irqs++;
+	ssd1306_port_dma_irq_handler();
+	sim.in_irq = 0;
+
+	/* The flags it was raised for must be cleared (IFCR applies on the
+	 * next cycle) */
+	if ((SIM_DMA->ISR & ~sim_dma_cleared(SIM_DMA->IFCR) & isr) != 0U) {
+		sim_violation("DMA interrupt returned without clearing its flags");
+		SIM_DMA_CH->CCR &= ~(DMA_CCR_TCIE | DMA_CCR_TEIE);
+	}
+}
+
+#else /* SSD1306_PORT_USE_IT */
+
+/* Raise the event or error interrupt when enabled and pending */
+static void sim_irq(void) {
+	I2C_TypeDef *i2c = SIM_I2C;
+	uint32_t sr1 = i2c->SR1;
+	uint32_t cr2 = i2c->CR2;
+	uint32_t before[4];
+
+	if (sim.in_irq) {
+		return;
+	}
+
+	before[0] = i2c->CR1;
+	before[1] = i2c->CR2;
+	before[2] = i2c->DR;
+	before[3] = i2c->SR1;
+
+	sim.in_irq = 1;
+	if ((cr2 & I2C_CR2_ITERREN) != 0U && (sr1 & SIM_ERRORS) != 0U) {
+		sim.er_irqs++;
+		ssd1306_port_i2c_er_irq_handler();
+	} else if ((cr2 & I2C_CR2_ITEVTEN) != 0U &&
+	           ((sr1 & (I2C_SR1_SB | I2C_SR1_ADDR | I2C_SR1_BTF)) != 0U ||
+	            ((cr2 & I2C_CR2_ITBUFEN) != 0U && (sr1 & I2C_SR1_TXE) != 0U))) {
+		sim.ev_irqs++;
+		ssd1306_port_i2c_ev_irq_handler();
+		if ((sr1 & I2C_SR1_ADDR) != 0U && sim.phase == SIM_ADDR) {
+			/* EV6 handled: the handler read SR1 and SR2 */
+			i2c->SR1 &= ~I2C_SR1_ADDR;
+			sim.phase = SIM_DATA;
+		}
+	} else {
+		sim.in_irq = 0;
+		sim.stuck = 0;
+		return;
+	}
+	sim.in_irq = 0;
+
+	/* An interrupt that changes nothing would fire forever */
+	if (before[0] == i2c->CR1 && before[1] == i2c->CR2 &&
+	    before[2] == i2c->DR && before[3] == i2c->SR1) {
+		if (++sim.stuck == SIM_IRQ_STUCK) {
+			sim_violation("interrupt keeps firing without progress");
+			i2c->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | I2C_CR2_ITERREN);
+		}
+	} else {
+		sim.stuck = 0;
+	}
+}
+
+#endif /* SSD1306_PORT_USE_DMA */
+
+void sim_cycle(void) {
+	I2C_TypeDef *i2c = SIM_I2C;
+
+	sim.cycles++;
+	sim_dwt.CYCCNT++;
+
+#ifdef SSD1306_PORT_USE_DMA
+	sim_dma();
+#endif
+
+	/* Writing DR clears TXE and BTF */
+	if (i2c->DR != SIM_DR_EMPTY) {
+		i2c->SR1 &= ~(I2C_SR1_TXE | I2C_SR1_BTF);
+	}
+
+	sim_bus();
+	sim_irq();
+}
+
+/* Workload
+ * ------------------------------------------------------------------------ */
+
+static uint32_t sim_batches;
+static uint32_t sim_batch_errors;
+
+/* A drained queue marks a flush in the recording */
+static void sim_on_complete(ssd1306_status_t status, void *ctx) {
+	static const uint8_t marker[3] = { 0xFFu, 0x00u, 0x00u };
+
+	(void)ctx;
+	sim_batches++;
+	if (status != SSD1306_OK) {
+		sim_batch_errors++;
+	}
+	fwrite(marker, 1, sizeof(marker), stdout);
+}
+
+static int sim_write_pbm(const char *path) {
+	FILE *f;
+	int x, y;
+
+	f = fopen(path, "w");
+	if (f == NULL) {
+		return -1;
+	}
+
+	fprintf(f, "P1\n%d %d\n", SSD1306_WIDTH, SSD1306_HEIGHT);
+	for (y = 0; y < SSD1306_HEIGHT; y++) {
+		for (x = 0; x < SSD1306_WIDTH; x++) {
+			fputc(((ssd1306_buffer[(y / 8) * SSD1306_WIDTH + x] >> (y % 8)) & 0x01u) ? '1' : '0', f);
+		}
+		fputc('\n', f);
+	}
+
+	return fclose(f);
+}
+
+int main(int argc, char **argv) {
+	const char *pbm = NULL;
+	unsigned long frames = 200;
+	unsigned long work = 20000;
+	unsigned long seed = 1;
+	unsigned long frame;
+	unsigned long i;
+	uint64_t work_cycles = 0;
+	uint64_t start;
+	uint64_t settle;
+	int a;
+
+	for (a = 1; a < argc; a++) {
+		if (a + 1 < argc && strcmp(argv[a], "-f") == 0) {
+			frames = strtoul(argv[++a], NULL, 0);
+		} else if (a + 1 < argc && strcmp(argv[a], "-s") == 0) {
+			seed = strtoul(argv[++a], NULL, 0);
+		} else if (a + 1 < argc && strcmp(argv[a], "-w") == 0) {
+			work = strtoul(argv[++a], NULL, 0);
+		} else if (a + 1 < argc && strcmp(argv[a], "-n") == 0) {
+			sim.nack_every = (uint32_t)strtoul(argv[++a], NULL, 0);
+#ifdef SSD1306_PORT_USE_DMA
+		} else if (a + 1 < argc && strcmp(argv[a], "-t") == 0) {
+			sim.te_every = (uint32_t)strtoul(argv[++a], NULL, 0);
+#endif
+		} else if (a + 1 < argc && strcmp(argv[a], "-o") == 0) {
+			pbm = argv[++a];
+		} else {
+#ifdef SSD1306_PORT_USE_DMA
+			fprintf(stderr, "usage: %s [-f frames] [-s seed] [-w cycles] [-n N] [-t N] [-o fb.pbm]\n", argv[0]);
+#else
+			fprintf(stderr, "usage: %s [-f frames] [-s seed] [-w cycles] [-n N] [-o fb.pbm]\n", argv[0]);
+#endif
+			return 2;
+		}
+	}
+
+	srand((unsigned)seed);
+	SIM_I2C->CR1 = I2C_CR1_PE;
+	SIM_I2C->DR = SIM_DR_EMPTY;
+
+	ssd1306_port_set_callbacks(NULL, sim_on_complete, NULL);
+
+	ssd1306_init();
+	ssd1306_flush_dirty();
+
+	start = sim.cycles;
+	for (frame = 0; frame < frames; frame++) {
+		ssd1306_buffer_fill_rect((int16_t)(rand() % SSD1306_WIDTH), (int16_t)(rand() % SSD1306_HEIGHT),
+		                         (int16_t)(rand() % 40), (int16_t)(rand() % 20),
+		                         (rand() & 1) ? White : Black);
+		ssd1306_buffer_draw_pixel((uint8_t)(rand() % SSD1306_WIDTH), (uint8_t)(rand() % SSD1306_HEIGHT), White);
+
+		if (frame % 4U == 3U) {
+			(void)ssd1306_flush_step(48);
+		} else {
+			ssd1306_flush_dirty();
+		}
+		/* Application work while the bus runs */
+		for (i = 0; i < work; i++) {
+			sim_cycle();
+		}
+		work_cycles += work;
+	}
+
+	/* Settle: after a failed batch the driver resends the whole frame,
+	 * once flushes are let through again */
+	settle = sim.cycles;
+	for (;;) {
+		ssd1306_flush_dirty();
+		if (ssd1306_wait_idle() == SSD1306_OK && !ssd1306_state.resync && !ssd1306_state.link_down) {
+			break;
+		}
+#ifdef SSD1306_PORT_USE_DMA
+		if (sim.nack_every == 0U && sim.te_every == 0U) {
+#else
+		if (sim.nack_every == 0U) {
+#endif
+			sim_violation("transport reported an error");
+		}
+		if (sim.cycles - settle > SIM_SETTLE_CYCLES) {
+			sim_violation("display never caught up");
+			break;
+		}
+		for (a = 0; a < 1000; a++) {
+			sim_cycle();
+		}
+	}
+	if (ssd1306_busy()) {
+		sim_violation("transport still busy at the end");
+	}
+
+	/* Let the last STOP reach the wire */
+	while (sim.phase != SIM_IDLE) {
+		sim_cycle();
+	}
+	fflush(stdout);
+
+	fprintf(stderr, "i2csim: %lu frames, %lu transactions, %lu bytes, %lu NACKs, %lu aborted\n",
+	        frames, (unsigned long)sim.sent, (unsigned long)sim.bytes,
+	        (unsigned long)sim.nacks, (unsigned long)sim.aborted);
+#ifdef SSD1306_PORT_USE_DMA
+	fprintf(stderr, "i2csim: %lu DMA transfers, %lu DMA interrupts, %lu transfer errors, %lu of %lu frame cycles spent waiting\n",
+	        (unsigned long)sim.dma_transfers, (unsigned long)sim.dma_irqs, (unsigned long)sim.dma_errors,
+	        (unsigned long)(sim.cycles - start - work_cycles), (unsigned long)(sim.cycles - start));
+#else
+	fprintf(stderr, "i2csim: %lu event / %lu error interrupts, %lu of %lu frame cycles spent waiting\n",
+	        (unsigned long)sim.ev_irqs, (unsigned long)sim.er_irqs,
+	        (unsigned long)(sim.cycles - start - work_cycles), (unsigned long)(sim.cycles - start));
+#endif
+	fprintf(stderr, "i2csim: %lu batches, %lu with errors\n",
+	        (unsigned long)sim_batches, (unsigned long)sim_batch_errors);
+
+	if (pbm != NULL && sim_write_pbm(pbm) != 0) {
+		fprintf(stderr, "i2csim: cannot write %s\n", pbm);
+		return 1;
+	}
+
+	return (sim.errors != 0U) ? 1 : 0;
+}
@@ -0,0 +1,103 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Даниил Еремеев
+ * See LICENSE file for details.
+ */
+
+/*
+ * ssd1306_imgconv.c
+ * Host-side converter: regenerates the row-major (MSB-first scanline)
+ * images of assets/ssd1306_images.c in the SSD1306 page-major (GRAM)
+ * layout used by ssd1306_buffer_draw_bitmap_pages().
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -std=c99 -Iassets tools/ssd1306_imgconv.c -o imgconv
+ *   ./imgconv > assets/ssd1306_images_pages.c
+ *
+ * Page-major image layout:
+ *   image[page * width + column], bit 0 = top row of the page,
+ *   width * ceil(height / 8) bytes in total.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "ssd1306_images.c"
+
+typedef struct {
+	const char		*name;
+	const uint8_t	*data;
+	uint16_t		width;
+	uint16_t		height;
+} imgconv_src_t;
+
+/* Pixel (x, y) of a row-major MSB-first image */
+static int imgconv_pixel(const imgconv_src_t *img, uint16_t x, uint16_t y) {
+	uint32_t bytes_per_row;
+
+	if (y >= img->height) {
+		return 0;
+	}
+
+	bytes_per_row = (uint32_t)(img->width + 7u) / 8u;
+
+	return (img->data[(uint32_t)y * bytes_per_row + x / 8u] >> (7u - (x % 8u))) & 0x01u;
+}
+
+static void imgconv_emit(const imgconv_src_t *img) {
+	uint16_t pages;
+	uint16_t page, col;
+	uint8_t bit;
+	uint8_t value;
+
+	pages = (uint16_t)((img->height + 7u) / 8u);
+
+	printf("const uint8_t %s_pages[] = {\n", img->name);
+
+	for (page = 0; page < pages; page++) {
+		for (col = 0; col < img->width; col++) {
+			value = 0;
+			for (bit = 0; bit < 8u; bit++) {
+				if (imgconv_pixel(img, col, (uint16_t)(page * 8u + bit))) {
+					value |= (uint8_t)(1u << bit);
+				}
+			}
+			if ((col % 16u) == 0u) {
+				printf("\t");
+			}
+			printf("0x%02x%s", value,
+			       (page + 1u == pages && col + 1u == img->width) ? "" : ",");
+			printf(((col % 16u) == 15u || col + 1u == img->width) ? "\n" : " ");
+		}
+	}
+
+	printf("};\n");
+}
+
+int main(void) {
+	static const imgconv_src_t images[] = {
+		{ "hots_logo_64x64", hots_logo_64x64, IMG_LOGO_WIDTH, IMG_LOGO_HEIGHT },
+	};
+	uint32_t i;
+
+	printf("/*\n");
+	printf(" * MIT License\n");
+	printf(" * Copyright (c) 2025 Даниил Еремеев\n");
+	printf(" * See LICENSE file for details.\n");
+	printf(" */\n\n");
+	printf("/*\n");
+	printf(" * Images in SSD1306 page-major (GRAM) layout, for ssd1306_buffer_draw_bitmap_pages().\n");
+	printf(" * Generated by tools/ssd1306_imgconv.c from assets/ssd1306_images.c - do not edit.\n");
+	printf(" */\n\n");
+	printf("#include \"ssd1306_images.h\"\n\n");
+
+	for (i = 0; i < sizeof(images) / sizeof(images[0]); i++) {
+		if (i != 0u) {
+			printf("\n");
+		}
+		imgconv_emit(&images[i]);
+	}
+
+	return 0;
+}
@@ -0,0 +1,286 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Даниил Еремеев
+ * See LICENSE file for details.
+ */
+
+/*
+ * ssd1306_replay.c
+ * Host-side decoder for byte streams recorded by the host transport
+ * (ssd1306_port_host.c). The stream is played into a model of the
+ * controller's GRAM; per-flush transaction and byte counts are printed
+ * and the resulting GRAM can be written out as a PBM image, as the panel
+ * shows it (rows from the display start line on).
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -std=c99 tools/ssd1306_replay.c -o replay
+ *   ./replay [-q] [-o gram.pbm] [recording]     (stdin without a file)
+ *
+ * -q prints only the totals. Bus bytes are counted as over I2C: payload
+ * plus address and control byte per transaction. Hardware scrolling is
+ * not played; data written to pages while they scroll is reported.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#define REPLAY_WIDTH   128
+#define REPLAY_PAGES   8
+
+#define REPLAY_REC_COMMANDS  0x00u
+#define REPLAY_REC_DATA      0x40u
+#define REPLAY_REC_FLUSH     0xFFu
+
+typedef struct {
+	uint8_t gram[REPLAY_PAGES][REPLAY_WIDTH];
+	uint8_t mode;                   /* 0: horizontal, 1: vertical, 2: page */
+	uint8_t col_start, col_end;
+	uint8_t page_start, page_end;
+	uint8_t col, page;
+	uint8_t start_line;             /* GRAM row shown first (0x40..0x7F) */
+	uint8_t scroll;                 /* scrolling active (0x2F) */
+	uint8_t scroll_start, scroll_end;
+	uint32_t scroll_writes;         /* data bytes written to scrolling pages */
+} replay_ctrl_t;
+
+typedef struct {
+	uint32_t transactions;
+	uint32_t cmd_bytes;
+	uint32_t data_bytes;
+} replay_count_t;
+
+static replay_ctrl_t ctrl;
+
+static void replay_reset(void) {
+	memset(&ctrl, 0, sizeof(ctrl));
+	ctrl.mode = 2;	/* reset default: page addressing */
+	ctrl.col_end = REPLAY_WIDTH - 1;
+	ctrl.page_end = REPLAY_PAGES - 1;
+}
+
+/* Parameter bytes following a command byte */
+static uint8_t replay_cmd_params(uint8_t cmd) {
+	switch (cmd) {
+	case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+	case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+		return 1;
+	case 0x21: case 0x22: case 0xA3:
+		return 2;
+	case 0x29: case 0x2A:
+		return 5;
+	case 0x26: case 0x27:
+		return 6;
+	default:
+		return 0;
+	}
+}
+
+static void replay_command_run(const uint8_t *c) {
+	switch (c[0]) {
+	case 0x20:
+		ctrl.mode = (uint8_t)(c[1] & 0x03u);
+		break;
+	case 0x21:
+		ctrl.col_start = (uint8_t)(c[1] & 0x7Fu);
+		ctrl.col_end = (uint8_t)(c[2] & 0x7Fu);
+		ctrl.col = ctrl.col_start;
+		break;
+	case 0x22:
+		ctrl.page_start = (uint8_t)(c[1] & 0x07u);
+		ctrl.page_end = (uint8_t)(c[2] & 0x07u);
+		ctrl.page = ctrl.page_start;
+		break;
+	case 0x26: case 0x27: case 0x29: case 0x2A:
+		ctrl.scroll_start = (uint8_t)(c[2] & 0x07u);
+		ctrl.scroll_end = (uint8_t)(c[4] & 0x07u);
+		break;
+	case 0x2E:
+		ctrl.scroll = 0;
+		break;
+	case 0x2F:
+		ctrl.scroll = 1;
+		break;
+	default:
+		if (c[0] <= 0x0Fu) {
+			ctrl.col = (uint8_t)((ctrl.col & 0xF0u) | c[0]);
+		} else if (c[0] <= 0x1Fu) {
+			ctrl.col = (uint8_t)(((c[0] & 0x07u) << 4) | (ctrl.col & 0x0Fu));
+		} else if (c[0] >= 0x40u && c[0] <= 0x7Fu) {
+			ctrl.start_line = (uint8_t)(c[0] & 0x3Fu);
+		} else if (c[0] >= 0xB0u && c[0] <= 0xB7u) {
+			ctrl.page = (uint8_t)(c[0] & 0x07u);
+		}
+		break;
+	}
+}
+
+/* Feed one command byte; a command's parameters may come in later
+ * transactions */
+static void replay_command(uint8_t byte) {
+	static uint8_t cmd[8];
+	static uint8_t len;
+	static uint8_t need;
+
+	if (len == 0U) {
+		need = replay_cmd_params(byte);
+	}
+	cmd[len++] = byte;
+
+	if (len > need) {
+		replay_command_run(cmd);
+		len = 0;
+	}
+}
+
+/* Store one data byte and advance the write pointer like the controller */
+static void replay_data(uint8_t byte) {
+	if (ctrl.scroll && (ctrl.page & 0x07u) >= ctrl.scroll_start && (ctrl.page & 0x07u) <= ctrl.scroll_end) {
+		ctrl.scroll_writes++;
+	}
+	ctrl.gram[ctrl.page & 0x07u][ctrl.col & 0x7Fu] = byte;
+
+	switch (ctrl.mode) {
+	case 0:
+		if (ctrl.col == ctrl.col_end) {
+			ctrl.col = ctrl.col_start;
+			ctrl.page = (ctrl.page == ctrl.page_end) ? ctrl.page_start : (uint8_t)(ctrl.page + 1u);
+		} else {
+			ctrl.col++;
+		}
+		break;
+	case 1:
+		if (ctrl.page == ctrl.page_end) {
+			ctrl.page = ctrl.page_start;
+			ctrl.col = (ctrl.col == ctrl.col_end) ? ctrl.col_start : (uint8_t)(ctrl.col + 1u);
+		} else {
+			ctrl.page++;
+		}
+		break;
+	default:
+		/* Page mode: the column wraps, the page stays */
+		ctrl.col = (uint8_t)((ctrl.col + 1u) & 0x7Fu);
+		break;
+	}
+}
+
+static void replay_print(const char *what, const replay_count_t *n) {
+	printf("%-8s %6lu tx %8lu cmd bytes %8lu data bytes %8lu bus bytes\n", what,
+	       (unsigned long)n->transactions, (unsigned long)n->cmd_bytes,
+	       (unsigned long)n->data_bytes,
+	       (unsigned long)(n->cmd_bytes + n->data_bytes + 2u * n->transactions));
+}
+
+static int replay_write_pbm(const char *path) {
+	FILE *f;
+	int x, y;
+	int row;
+
+	f = fopen(path, "w");
+	if (f == NULL) {
+		return -1;
+	}
+
+	fprintf(f, "P1\n%d %d\n", REPLAY_WIDTH, REPLAY_PAGES * 8);
+	for (y = 0; y < REPLAY_PAGES * 8; y++) {
+		row = (y + ctrl.start_line) % (REPLAY_PAGES * 8);
+		for (x = 0; x < REPLAY_WIDTH; x++) {
+			fputc(((ctrl.gram[row / 8][x] >> (row % 8)) & 0x01u) ? '1' : '0', f);
+		}
+		fputc('\n', f);
+	}
+
+	return fclose(f);
+}
+
+int main(int argc, char **argv) {
+	static uint8_t payload[0x10000];
+	const char *pbm = NULL;
+	const char *path = NULL;
+	FILE *in;
+	int quiet = 0;
+	int i;
+	uint8_t header[3];
+	uint16_t size;
+	uint16_t pos;
+	uint32_t flushes = 0;
+	replay_count_t flush;
+	replay_count_t total;
+
+	for (i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-q") == 0) {
+			quiet = 1;
+		} else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+			pbm = argv[++i];
+		} else {
+			path = argv[i];
+		}
+	}
+
+	in = (path != NULL) ? fopen(path, "rb") : stdin;
+	if (in == NULL) {
+		fprintf(stderr, "replay: cannot open %s\n", path);
+		return 1;
+	}
+
+	replay_reset();
+	memset(&flush, 0, sizeof(flush));
+	memset(&total, 0, sizeof(total));
+
+	while (fread(header, 1, sizeof(header), in) == sizeof(header)) {
+		size = (uint16_t)(header[1] | (header[2] << 8));
+		if (size != 0U && fread(payload, 1, size, in) != size) {
+			fprintf(stderr, "replay: truncated record\n");
+			return 1;
+		}
+
+		if (header[0] == REPLAY_REC_FLUSH) {
+			flushes++;
+			if (!quiet) {
+				char name[24];
+
+				sprintf(name, "flush %lu", (unsigned long)flushes);
+				replay_print(name, &flush);
+			}
+			memset(&flush, 0, sizeof(flush));
+			continue;
+		}
+
+		flush.transactions++;
+		total.transactions++;
+
+		if (header[0] == REPLAY_REC_DATA) {
+			flush.data_bytes += size;
+			total.data_bytes += size;
+			for (pos = 0; pos < size; pos++) {
+				replay_data(payload[pos]);
+			}
+		} else if (header[0] == REPLAY_REC_COMMANDS) {
+			flush.cmd_bytes += size;
+			total.cmd_bytes += size;
+			for (pos = 0; pos < size; pos++) {
+				replay_command(payload[pos]);
+			}
+		} else {
+			fprintf(stderr, "replay: unknown record 0x%02X\n", header[0]);
+			return 1;
+		}
+	}
+
+	if (flush.transactions != 0U && !quiet) {
+		replay_print("tail", &flush);
+	}
+	printf("%lu flushes\n", (unsigned long)flushes);
+	replay_print("total", &total);
+	if (ctrl.scroll_writes != 0U) {
+		printf("%lu data bytes written to scrolling pages\n", (unsigned long)ctrl.scroll_writes);
+	}
+
+	if (pbm != NULL && replay_write_pbm(pbm) != 0) {
+		fprintf(stderr, "replay: cannot write %s\n", pbm);
+		return 1;
+	}
+
+	return 0;
+}
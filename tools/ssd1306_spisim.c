@@ -0,0 +1,585 @@
+/*
+ * MIT License
+ * Copyright (c) 2025 Даниил Еремеев
+ * See LICENSE file for details.
+ */
+
+/*
+ * ssd1306_spisim.c
+ * Host-side simulator for the 4-wire SPI transport (SSD1306_USE_SPI),
+ * polled or over DMA (SSD1306_SPI_USE_DMA). The real driver and port
+ * (src/) run against a register model of the SPI peripheral and the CS,
+ * DC and RST pins: bytes written to DR go through a one-byte buffer and
+ * a shift register, and the display samples DC on the last bit of every
+ * byte. In the DMA build a model of the DMA1 channel feeds DR on TXE and
+ * raises the transfer-complete / transfer-error interrupt. A random
+ * drawing workload is flushed through it, and every CS-low period is
+ * written to stdout as one transaction in the host transport's recording
+ * format (ssd1306_port_host.h), ready for tools/ssd1306_replay.c.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -std=c99 -DSSD1306_USE_SPI -Itools/spisim -Iinclude -Isrc/inc \
+ *      -Iassets src/ssd1306*.c assets/ssd1306*.c tools/ssd1306_spisim.c -o spisim
+ *   ./spisim -o fb.pbm | ./replay -q -o gram.pbm && cmp fb.pbm gram.pbm
+ *
+ * The DMA build adds -DSSD1306_SPI_USE_DMA.
+ *
+ * Options: -f frames, -s seed, -w core cycles of application work per
+ * frame, -t N (DMA build) to fail every Nth DMA transfer halfway with a
+ * transfer error, -o to write the final framebuffer as PBM. After
+ * transfer errors the driver resends the whole frame; the run ends once
+ * the display has caught up. Bus protocol violations (DC changing while
+ * CS is low, a byte clocked with CS high, CS released under a byte) are
+ * reported on stderr and make the exit status non-zero.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ssd1306.h"
+#include "ssd1306_priv.h"
+#include "ssd1306_port_stm32.h"
+
+#ifndef SSD1306_USE_SPI
+#error "Build the SPI simulator with SSD1306_USE_SPI"
+#endif
+
+/* Register model
+ * ------------------------------------------------------------------------ */
+
+static uint32_t sim_spi1_status(void);
+static uint32_t sim_spi2_status(void);
+
+SPI_TypeDef sim_spi1 = { 0, 0, sim_spi1_status, 0, 0, 0, 0 };
+SPI_TypeDef sim_spi2 = { 0, 0, sim_spi2_status, 0, 0, 0, 0 };
+GPIO_TypeDef sim_gpioa, sim_gpiob, sim_gpioc;
+DMA_TypeDef sim_dma1;
+DMA_Channel_TypeDef sim_dma1_channel[7];
+DWT_Type sim_dwt;
+CoreDebug_Type sim_core_debug;
+SysTick_Type sim_systick;
+uint32_t SystemCoreClock = 8000000UL;
+
+void SystemCoreClockUpdate(void) {
+	;
+}
+
+#define SIM_SPI           (&sim_spi1)
+#define SIM_DR_EMPTY      0xFFFFFFFFUL	/* DR not written since last taken */
+#define SIM_BYTE_CYCLES   16U			/* 8 bits at 4 MHz, 8 MHz core */
+#define SIM_SETTLE_CYCLES 24000000UL	/* 3 s: past a link retry */
+
+/* The pins as the display sees them */
+#define SIM_PIN(port, pin)  ((((port)->ODR) >> (pin)) & 0x1U)
+
+#ifdef SSD1306_PORT_USE_DMA
+#define SIM_DMA          (SSD1306_PORT_DMA)
+#define SIM_DMA_CH       (SSD1306_PORT_DMA_CHANNEL)
+#define SIM_DMA_SHIFT    (4U * (SSD1306_PORT_DMA_CHANNEL_NUM - 1U))
+#define SIM_DMA_GIF      (0x1UL << SIM_DMA_SHIFT)
+#define SIM_DMA_TCIF     (0x2UL << SIM_DMA_SHIFT)
+#define SIM_DMA_TEIF     (0x8UL << SIM_DMA_SHIFT)
+#endif
+
+static struct {
+	uint8_t  cs;			/* pin levels last seen */
+	uint8_t  dc;
+	uint8_t  rst;
+	uint8_t  shifting;		/* a byte is in the shift register */
+	uint8_t  shift;
+	uint32_t wait;			/* cycles until it is out */
+	uint8_t  tx_dc;			/* DC when CS went low */
+	uint8_t  tx[SSD1306_BUFFER_SIZE + 64];
+	uint32_t tx_len;
+	uint8_t  in_irq;
+	uint32_t sent;			/* transactions recorded */
+	uint32_t bytes;
+	uint32_t empty;			/* CS pulses without a byte */
+	uint32_t resets;
+	uint32_t aborted;
+	uint32_t errors;		/* protocol violations */
+	uint64_t cycles;
+#ifdef SSD1306_PORT_USE_DMA
+	uint8_t  dma_on;		/* transfer in progress */
+	uint8_t  dma_cut;		/* this transaction lost a transfer to an error */
+	uint32_t dma_size;		/* CNDTR when the channel was enabled */
+	uint32_t dma_fail_at;	/* CNDTR at which to raise TE, 0: none */
+	uint32_t te_every;
+	uint32_t dma_transfers;
+	uint32_t dma_irqs;
+	uint32_t dma_errors;
+#endif
+} sim;
+
+static void sim_violation(const char *what) {
+	sim.errors++;
+	if (sim.errors <= 10U) {
+		fprintf(stderr, "spisim: %s (cycle %lu)\n", what, (unsigned long)sim.cycles);
+	}
+}
+
+/* Record one transaction (control byte from DC, payload) to stdout */
+static void sim_emit(void) {
+	uint8_t header[3];
+
+	header[0] = sim.tx_dc ? 0x40u : 0x00u;
+	header[1] = (uint8_t)sim.tx_len;
+	header[2] = (uint8_t)(sim.tx_len >> 8);
+	fwrite(header, 1, sizeof(header), stdout);
+	fwrite(sim.tx, 1, sim.tx_len, stdout);
+
+	sim.sent++;
+	sim.bytes += sim.tx_len;
+}
+
+/* Apply pending BSRR writes and follow the CS / DC / RST edges */
+static void sim_pins(void) {
+	static uint8_t busy;
+	GPIO_TypeDef *ports[3];
+	uint8_t cs, dc, rst;
+	unsigned i;
+
+	/* Naming the configured ports below comes back here */
+	if (busy) {
+		return;
+	}
+	busy = 1;
+
+	ports[0] = &sim_gpioa;
+	ports[1] = &sim_gpiob;
+	ports[2] = &sim_gpioc;
+	for (i = 0; i < 3U; i++) {
+		if (ports[i]->BSRR != 0U) {
+			ports[i]->ODR = (ports[i]->ODR | (ports[i]->BSRR & 0xFFFFU)) & ~(ports[i]->BSRR >> 16);
+			ports[i]->BSRR = 0;
+		}
+	}
+
+	cs = (uint8_t)SIM_PIN(SSD1306_SPI_CS_GPIO, SSD1306_SPI_CS_PIN);
+	dc = (uint8_t)SIM_PIN(SSD1306_SPI_DC_GPIO, SSD1306_SPI_DC_PIN);
+#ifdef SSD1306_SPI_RST_GPIO
+	rst = (uint8_t)SIM_PIN(SSD1306_SPI_RST_GPIO, SSD1306_SPI_RST_PIN);
+#else
+	rst = 1;
+#endif
+
+	if (cs == 0U && sim.cs != 0U) {
+		/* CS falls: a transaction starts, in the mode DC selects */
+		sim.tx_dc = dc;
+		sim.tx_len = 0;
+	} else if (cs == 0U && dc != sim.dc) {
+		sim_violation("DC changed while CS is low");
+	} else if (cs != 0U && sim.cs == 0U) {
+		/* CS rises: the transaction ends */
+		if (sim.shifting || SIM_SPI->DR != SIM_DR_EMPTY) {
+			sim_violation("CS released while a byte is on the wire");
+		}
+#ifdef SSD1306_PORT_USE_DMA
+		if (sim.dma_cut) {
+			/* Cut short by a transfer error: not recorded, the driver
+			 * resends the frame */
+			sim.dma_cut = 0;
+			sim.aborted++;
+		} else
+#endif
+		if (sim.tx_len != 0U) {
+			sim_emit();
+		} else {
+			sim.empty++;
+		}
+	}
+
+	if (rst == 0U && sim.rst != 0U) {
+		sim.resets++;
+		if (cs == 0U) {
+			sim_violation("reset with CS low");
+		}
+	}
+
+	sim.cs = cs;
+	sim.dc = dc;
+	sim.rst = rst;
+	busy = 0;
+}
+
+GPIO_TypeDef *sim_gpio(GPIO_TypeDef *gpio) {
+	sim_pins();
+	return gpio;
+}
+
+/* Move a byte written to DR into an idle shift register */
+static void sim_spi_load(void) {
+	SPI_TypeDef *spi = SIM_SPI;
+
+	if (sim.shifting || spi->DR == SIM_DR_EMPTY) {
+		return;
+	}
+
+	if ((spi->CR1 & SPI_CR1_SPE) == 0U) {
+		sim_violation("DR written with the peripheral disabled");
+	}
+	sim_pins();
+	if (sim.cs != 0U) {
+		sim_violation("byte clocked with CS high");
+	}
+
+	sim.shift = (uint8_t)spi->DR;
+	sim.shifting = 1;
+	sim.wait = SIM_BYTE_CYCLES;
+	spi->DR = SIM_DR_EMPTY;
+}
+
+static uint32_t sim_spi1_status(void) {
+	uint32_t status = 0;
+
+	sim_spi_load();
+	if (SIM_SPI->DR == SIM_DR_EMPTY) {
+		status |= SPI_SR_TXE;
+	}
+	if (sim.shifting || SIM_SPI->DR != SIM_DR_EMPTY) {
+		status |= SPI_SR_BSY;
+	}
+
+	return status;
+}
+
+static uint32_t sim_spi2_status(void) {
+	sim_violation("SPI2 is not modelled");
+	return SPI_SR_TXE;
+}
+
+/* Advance the shift register by one core cycle */
+static void sim_spi(void) {
+	sim_spi_load();
+
+	if (!sim.shifting || --sim.wait != 0U) {
+		return;
+	}
+
+	/* Last bit: the display latches the byte with DC as it is now */
+	sim.shifting = 0;
+	if (sim.cs != 0U) {
+		sim_violation("CS high at the end of a byte");
+	} else if (sim.tx_len < sizeof(sim.tx)) {
+		sim.tx[sim.tx_len++] = sim.shift;
+	} else {
+		sim_violation("transaction too long");
+	}
+
+	sim_spi_load();
+}
+
+#ifdef SSD1306_PORT_USE_DMA
+
+/* Flags cleared by an IFCR write: CGIFx clears every flag of channel x */
+static uint32_t sim_dma_cleared(uint32_t ifcr) {
+	uint32_t clear = ifcr;
+	unsigned n;
+
+	for (n = 0; n < 7U; n++) {
+		if ((ifcr & (0x1UL << (4U * n))) != 0U) {
+			clear |= 0xFUL << (4U * n);
+		}
+	}
+
+	return clear;
+}
+
+/* Advance the DMA channel by one core cycle: one byte into DR per TXE
+ * request while TXDMAEN is set */
+static void sim_dma(void) {
+	SPI_TypeDef *spi = SIM_SPI;
+	DMA_Channel_TypeDef *ch = SIM_DMA_CH;
+	const uint8_t *mem;
+
+	/* IFCR: write 1 to clear */
+	SIM_DMA->ISR &= ~sim_dma_cleared(SIM_DMA->IFCR);
+	SIM_DMA->IFCR = 0;
+
+	if ((ch->CCR & DMA_CCR_EN) == 0U) {
+		sim.dma_on = 0;
+		return;
+	}
+	if (!sim.dma_on) {
+		if (ch->CNDTR == 0U) {
+			/* Finished, not disabled yet */
+			return;
+		}
+		/* Channel (re)armed: it may be disabled, set up and enabled
+		 * again between two cycles */
+		sim.dma_on = 1;
+		sim.dma_size = ch->CNDTR;
+		sim.dma_transfers++;
+		sim.dma_fail_at = 0;
+		if (sim.te_every != 0U && sim.dma_transfers % sim.te_every == 0U) {
+			sim.dma_fail_at = ch->CNDTR / 2U + 1U;
+		}
+		if ((ch->CCR & (DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_PINC | DMA_CCR_CIRC)) !=
+		    (DMA_CCR_DIR | DMA_CCR_MINC)) {
+			sim_violation("DMA channel not set up memory to peripheral");
+		}
+		if (ch->CPAR != (uintptr_t)&spi->DR) {
+			sim_violation("DMA channel not pointed at SPI DR");
+		}
+	}
+
+	if (ch->CNDTR == 0U || (spi->CR2 & SPI_CR2_TXDMAEN) == 0U || spi->DR != SIM_DR_EMPTY) {
+		return;
+	}
+
+	if (ch->CNDTR == sim.dma_fail_at) {
+		/* Transfer error: the channel disables itself */
+		sim.dma_errors++;
+		sim.dma_cut = 1;
+		sim.dma_on = 0;
+		ch->CCR &= ~DMA_CCR_EN;
+		SIM_DMA->ISR |= SIM_DMA_GIF | SIM_DMA_TEIF;
+		return;
+	}
+
+	mem = (const uint8_t *)(uintptr_t)ch->CMAR;
+	spi->DR = mem[sim.dma_size - ch->CNDTR];
+	ch->CNDTR--;
+	if (ch->CNDTR == 0U) {
+		sim.dma_on = 0;
+		SIM_DMA->ISR |= SIM_DMA_GIF | SIM_DMA_TCIF;
+	}
+}
+
+/* Raise the channel interrupt when enabled and pending */
+static void sim_irq(void) {
+	uint32_t ccr = SIM_DMA_CH->CCR;
+	uint32_t isr = SIM_DMA->ISR & (SIM_DMA_TCIF | SIM_DMA_TEIF);
+
+	if (sim.in_irq) {
+		return;
+	}
+	if (((isr & SIM_DMA_TCIF) == 0U || (ccr & DMA_CCR_TCIE) == 0U) &&
+	    ((isr & SIM_DMA_TEIF) == 0U || (ccr & DMA_CCR_TEIE) == 0U)) {
+		return;
+	}
+
+	sim.in_irq = 1;
+	sim.dma_irqs++;
+	ssd1306_port_dma_irq_handler();
+	sim.in_irq = 0;
+
+	/* The flags it was raised for must be cleared (IFCR applies on the
+	 * next cycle) */
+	if ((SIM_DMA->ISR & ~sim_dma_cleared(SIM_DMA->IFCR) & isr) != 0U) {
+		sim_violation("DMA interrupt returned without clearing its flags");
+		SIM_DMA_CH->CCR &= ~(DMA_CCR_TCIE | DMA_CCR_TEIE);
+	}
+}
+
+#endif /* SSD1306_PORT_USE_DMA */
+
+void sim_cycle(void) {
+	sim.cycles++;
+	sim_dwt.CYCCNT++;
+
+	sim_pins();
+#ifdef SSD1306_PORT_USE_DMA
+	sim_dma();
+#endif
+	sim_spi();
+#ifdef SSD1306_PORT_USE_DMA
+	sim_irq();
+#endif
+}
+
+/* Workload
+ * ------------------------------------------------------------------------ */
+
+static uint32_t sim_batches;
+static uint32_t sim_batch_errors;
+
+/* End of a flush in the recording */
+static void sim_marker(void) {
+	static const uint8_t marker[3] = { 0xFFu, 0x00u, 0x00u };
+
+	fwrite(marker, 1, sizeof(marker), stdout);
+}
+
+#ifdef SSD1306_PORT_USE_QUEUE
+
+/* A drained queue marks a flush */
+static void sim_on_complete(ssd1306_status_t status, void *ctx) {
+	(void)ctx;
+	sim_batches++;
+	if (status != SSD1306_OK) {
+		sim_batch_errors++;
+	}
+	sim_marker();
+}
+
+#else
+
+/* Polled: everything is on the wire once the flush returns */
+static void sim_flushed(void) {
+	sim_pins();
+	sim_batches++;
+	if (ssd1306_flush_status() != SSD1306_OK) {
+		sim_batch_errors++;
+	}
+	sim_marker();
+}
+
+#endif
+
+static int sim_write_pbm(const char *path) {
+	FILE *f;
+	int x, y;
+
+	f = fopen(path, "w");
+	if (f == NULL) {
+		return -1;
+	}
+
+	fprintf(f, "P1\n%d %d\n", SSD1306_WIDTH, SSD1306_HEIGHT);
+	for (y = 0; y < SSD1306_HEIGHT; y++) {
+		for (x = 0; x < SSD1306_WIDTH; x++) {
+			fputc(((ssd1306_buffer[(y / 8) * SSD1306_WIDTH + x] >> (y % 8)) & 0x01u) ? '1' : '0', f);
+		}
+		fputc('\n', f);
+	}
+
+	return fclose(f);
+}
+
+int main(int argc, char **argv) {
+	const char *pbm = NULL;
+	unsigned long frames = 200;
+	unsigned long work = 20000;
+	unsigned long seed = 1;
+	unsigned long frame;
+	unsigned long i;
+	uint64_t work_cycles = 0;
+	uint64_t start;
+	uint64_t settle;
+	int a;
+
+	for (a = 1; a < argc; a++) {
+		if (a + 1 < argc && strcmp(argv[a], "-f") == 0) {
+			frames = strtoul(argv[++a], NULL, 0);
+		} else if (a + 1 < argc && strcmp(argv[a], "-s") == 0) {
+			seed = strtoul(argv[++a], NULL, 0);
+		} else if (a + 1 < argc && strcmp(argv[a], "-w") == 0) {
+			work = strtoul(argv[++a], NULL, 0);
+#ifdef SSD1306_PORT_USE_DMA
+		} else if (a + 1 < argc && strcmp(argv[a], "-t") == 0) {
+			sim.te_every = (uint32_t)strtoul(argv[++a], NULL, 0);
+#endif
+		} else if (a + 1 < argc && strcmp(argv[a], "-o") == 0) {
+			pbm = argv[++a];
+		} else {
+#ifdef SSD1306_PORT_USE_DMA
+			fprintf(stderr, "usage: %s [-f frames] [-s seed] [-w cycles] [-t N] [-o fb.pbm]\n", argv[0]);
+#else
+			fprintf(stderr, "usage: %s [-f frames] [-s seed] [-w cycles] [-o fb.pbm]\n", argv[0]);
+#endif
+			return 2;
+		}
+	}
+
+	srand((unsigned)seed);
+	SIM_SPI->CR1 = SPI_CR1_MSTR | SPI_CR1_SPE;
+	SIM_SPI->DR = SIM_DR_EMPTY;
+	/* Pins idle high, as with pull-ups before the port drives them */
+	sim_gpioa.ODR = sim_gpiob.ODR = sim_gpioc.ODR = 0xFFFFU;
+	sim.cs = 1;
+	sim.dc = 1;
+	sim.rst = 1;
+
+#ifdef SSD1306_PORT_USE_QUEUE
+	ssd1306_port_set_callbacks(NULL, sim_on_complete, NULL);
+#endif
+
+	ssd1306_init();
+	ssd1306_flush_dirty();
+#ifndef SSD1306_PORT_USE_QUEUE
+	sim_flushed();
+#endif
+
+	start = sim.cycles;
+	for (frame = 0; frame < frames; frame++) {
+		ssd1306_buffer_fill_rect((int16_t)(rand() % SSD1306_WIDTH), (int16_t)(rand() % SSD1306_HEIGHT),
+		                         (int16_t)(rand() % 40), (int16_t)(rand() % 20),
+		                         (rand() & 1) ? White : Black);
+		ssd1306_buffer_draw_pixel((uint8_t)(rand() % SSD1306_WIDTH), (uint8_t)(rand() % SSD1306_HEIGHT), White);
+
+		if (frame % 4U == 3U) {
+			(void)ssd1306_flush_step(48);
+		} else {
+			ssd1306_flush_dirty();
+		}
+#ifndef SSD1306_PORT_USE_QUEUE
+		sim_flushed();
+#endif
+		/* Application work while the bus runs */
+		for (i = 0; i < work; i++) {
+			sim_cycle();
+		}
+		work_cycles += work;
+	}
+
+	/* Settle: after a failed batch the driver resends the whole frame,
+	 * once flushes are let through again */
+	settle = sim.cycles;
+	for (;;) {
+		ssd1306_flush_dirty();
+#ifndef SSD1306_PORT_USE_QUEUE
+		sim_flushed();
+#endif
+		if (ssd1306_wait_idle() == SSD1306_OK && !ssd1306_state.resync && !ssd1306_state.link_down) {
+			break;
+		}
+#ifdef SSD1306_PORT_USE_DMA
+		if (sim.te_every == 0U) {
+#endif
+			sim_violation("transport reported an error");
+#ifdef SSD1306_PORT_USE_DMA
+		}
+#endif
+		if (sim.cycles - settle > SIM_SETTLE_CYCLES) {
+			sim_violation("display never caught up");
+			break;
+		}
+		for (a = 0; a < 1000; a++) {
+			sim_cycle();
+		}
+	}
+	if (ssd1306_busy()) {
+		sim_violation("transport still busy at the end");
+	}
+
+	/* Let the last CS edge reach the model */
+	sim_cycle();
+	if (sim.cs == 0U) {
+		sim_violation("CS still low at the end");
+	}
+	fflush(stdout);
+
+	fprintf(stderr, "spisim: %lu frames, %lu transactions, %lu bytes, %lu empty, %lu aborted, %lu resets\n",
+	        frames, (unsigned long)sim.sent, (unsigned long)sim.bytes,
+	        (unsigned long)sim.empty, (unsigned long)sim.aborted, (unsigned long)sim.resets);
+#ifdef SSD1306_PORT_USE_DMA
+	fprintf(stderr, "spisim: %lu DMA transfers, %lu DMA interrupts, %lu transfer errors, %lu of %lu frame cycles spent waiting\n",
+	        (unsigned long)sim.dma_transfers, (unsigned long)sim.dma_irqs, (unsigned long)sim.dma_errors,
+	        (unsigned long)(sim.cycles - start - work_cycles), (unsigned long)(sim.cycles - start));
+#else
+	fprintf(stderr, "spisim: %lu of %lu frame cycles spent waiting\n",
+	        (unsigned long)(sim.cycles - start - work_cycles), (unsigned long)(sim.cycles - start));
+#endif
+	fprintf(stderr, "spisim: %lu batches, %lu with errors\n",
+	        (unsigned long)sim_batches, (unsigned long)sim_batch_errors);
+
+	if (pbm != NULL && sim_write_pbm(pbm) != 0) {
+		fprintf(stderr, "spisim: cannot write %s\n", pbm);
+		return 1;
+	}
+
+	return (sim.errors != 0U) ? 1 : 0;
+}